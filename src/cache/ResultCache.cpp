@@ -0,0 +1,136 @@
+/**
+ * @file ResultCache.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to cache the results of a PDA for repeated input strings.
+ * @date 19/10/2026
+ */
+
+#include "ResultCache.hpp"
+
+/**
+ * @brief Constructs a new ResultCache object.
+ * 
+ * @param MAX_MEMORY Maximum number of bytes used by the entries of the cache.
+ */
+ResultCache::ResultCache(const size_t MAX_MEMORY) : maxMemory(MAX_MEMORY), memoryUsage(0), hits(0), misses(0) {}
+
+/**
+ * @brief Looks for the result of an input string, marking the entry as the most recently used.
+ * 
+ * @param FINGERPRINT Fingerprint of the automaton.
+ * @param INPUT Input string to look for.
+ * @param accepted Set to the cached result if the input string is found.
+ * @return true If the input string is found.
+ * @return false If the input string is not found.
+ */
+bool ResultCache::Find(const size_t FINGERPRINT, const std::string& INPUT, bool& accepted) {
+  std::lock_guard<std::mutex> lock{mutex};
+  const auto FOUND{index.find(CacheKey{FINGERPRINT, std::hash<std::string>{}(INPUT)})};
+  if (FOUND == index.end() || std::get<1>(*FOUND->second) != INPUT) {
+    ++misses;
+    return false;
+  }
+  entries.splice(entries.begin(), entries, FOUND->second);
+  accepted = std::get<2>(*FOUND->second);
+  ++hits;
+  return true;
+}
+
+/**
+ * @brief Stores the result of an input string, evicting the least recently used entries if the memory cap is exceeded.
+ * 
+ * @param FINGERPRINT Fingerprint of the automaton.
+ * @param INPUT Input string.
+ * @param ACCEPTED Result of the automaton for the input string.
+ */
+void ResultCache::Insert(const size_t FINGERPRINT, const std::string& INPUT, const bool ACCEPTED) {
+  const size_t ENTRY_MEMORY{EntryMemory(INPUT)};
+  if (ENTRY_MEMORY > maxMemory) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock{mutex};
+  const CacheKey KEY{FINGERPRINT, std::hash<std::string>{}(INPUT)};
+  // Replacing the previous entry with the same key, which may be a hash collision.
+  const auto FOUND{index.find(KEY)};
+  if (FOUND != index.end()) {
+    Erase(FOUND->second);
+  }
+  while (memoryUsage + ENTRY_MEMORY > maxMemory) {
+    Erase(std::prev(entries.end()));
+  }
+  entries.emplace_front(KEY, INPUT, ACCEPTED);
+  index.emplace(KEY, entries.begin());
+  memoryUsage += ENTRY_MEMORY;
+}
+
+/**
+ * @brief Removes every entry of the cache and resets the counters.
+ */
+void ResultCache::Clear() {
+  std::lock_guard<std::mutex> lock{mutex};
+  entries.clear();
+  index.clear();
+  memoryUsage = 0;
+  hits = 0;
+  misses = 0;
+}
+
+/**
+ * @brief Returns the number of lookups which found the input string.
+ * 
+ * @return The number of hits.
+ */
+size_t ResultCache::Hits() const {
+  return hits;
+}
+
+/**
+ * @brief Returns the number of lookups which did not find the input string.
+ * 
+ * @return The number of misses.
+ */
+size_t ResultCache::Misses() const {
+  return misses;
+}
+
+/**
+ * @brief Returns the ratio of lookups which found the input string.
+ * 
+ * @return The hit rate, or 0 if there have been no lookups.
+ */
+double ResultCache::HitRate() const {
+  const size_t HITS{hits};
+  const size_t LOOKUPS{HITS + misses};
+  return LOOKUPS == 0 ? 0.0 : static_cast<double>(HITS) / LOOKUPS;
+}
+
+/**
+ * @brief Returns the number of bytes used by the entries of the cache.
+ * 
+ * @return The memory used by the cache.
+ */
+size_t ResultCache::MemoryUsage() const {
+  std::lock_guard<std::mutex> lock{mutex};
+  return memoryUsage;
+}
+
+/**
+ * @brief Estimates the number of bytes used by an entry, including its list node and its index node.
+ * 
+ * @param INPUT Input string of the entry.
+ * @return The memory used by the entry.
+ */
+size_t ResultCache::EntryMemory(const std::string& INPUT) {
+  return sizeof(CacheEntry) + 2 * sizeof(void*) + sizeof(std::pair<CacheKey, std::list<CacheEntry>::iterator>) + 2 * sizeof(void*) + INPUT.size();
+}
+
+/**
+ * @brief Removes an entry from the cache. The mutex must be held by the caller.
+ * 
+ * @param entry Entry to remove.
+ */
+void ResultCache::Erase(const std::list<CacheEntry>::iterator entry) {
+  memoryUsage -= EntryMemory(std::get<1>(*entry));
+  index.erase(std::get<0>(*entry));
+  entries.erase(entry);
+}
@@ -0,0 +1,61 @@
+/**
+ * @file ResultCache.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to cache the results of a PDA for repeated input strings.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+/**
+ * @brief Class to cache the results of PDAs for repeated input strings. Entries are keyed by the fingerprint of the automaton
+ *        and the hash of the input string, and the full input string is kept to discard hash collisions. When the memory
+ *        used by the entries exceeds the given cap, the least recently used ones are evicted. The cache can be shared
+ *        between threads and PDAs. Only completed results are stored, never the strings whose evaluation threw.
+ */
+class ResultCache {
+  public:
+    ResultCache(size_t);
+    bool Find(size_t, const std::string&, bool&);
+    void Insert(size_t, const std::string&, bool);
+    void Clear();
+    size_t Hits() const;
+    size_t Misses() const;
+    double HitRate() const;
+    size_t MemoryUsage() const;
+  private:
+    /**
+     * @brief Type to represent the key of an entry: the fingerprint of the automaton and the hash of the input string.
+     */
+    using CacheKey = std::pair<size_t, size_t>;
+
+    /**
+     * @brief Hash of the key of an entry.
+     */
+    struct CacheKeyHash {
+      size_t operator()(const CacheKey& KEY) const { return KEY.first ^ (KEY.second + 0x9E3779B97F4A7C15ULL + (KEY.first << 6) + (KEY.first >> 2)); }
+    };
+
+    /**
+     * @brief Type to represent an entry of the cache. The tuple contains the key, the input string and the result.
+     */
+    using CacheEntry = std::tuple<CacheKey, std::string, bool>;
+
+    const size_t maxMemory;
+    size_t memoryUsage;
+    mutable std::mutex mutex;
+    std::list<CacheEntry> entries;
+    std::unordered_map<CacheKey, std::list<CacheEntry>::iterator, CacheKeyHash> index;
+    std::atomic<size_t> hits;
+    std::atomic<size_t> misses;
+    static size_t EntryMemory(const std::string&);
+    void Erase(std::list<CacheEntry>::iterator);
+};
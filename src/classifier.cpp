@@ -0,0 +1,42 @@
+/**
+ * @file classifier.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the client code to classify input strings against many PDAs at once.
+ * @date 19/10/2026
+ */
+
+#include "registry/PDARegistry.hpp"
+
+/**
+ * @brief Main function which loads every given PDA into a registry and prints, for each input string, the PDAs accepting it.
+ * @return 0 on success, 1 on failure.
+ */
+int main(const int ARGC, const char* ARGV[]) {
+  if (ARGC < 2) {
+    std::cerr << "Usage: " << ARGV[0] << " <PDAFileName>..." << std::endl;
+    return EXIT_FAILURE;
+  }
+  try {
+    PDARegistry registry{std::max(1u, std::thread::hardware_concurrency())};
+    for (int i{1}; i < ARGC; ++i) {
+      registry.Load(ARGV[i], ARGV[i]);
+    }
+    std::cout << registry.Size() << " PDAs loaded into the registry";
+    std::cout << "\nReading input strings from console (empty string to exit)...\n";
+    for (std::string input; std::getline(std::cin, input) && !input.empty();) {
+      const RegistryResult RESULT{registry.Evaluate(input)};
+      for (size_t i{0}; i < registry.Size(); ++i) {
+        std::cout << (RESULT.IsAccepted(i) ? '1' : (RESULT.IsFailed(i) ? '!' : '0'));
+      }
+      std::cout << "\n";
+      for (size_t i{0}; i < registry.Size(); ++i) {
+        if (RESULT.IsAccepted(i)) {
+          std::cout << "--> Accepted by " << registry.NameOf(i) << "\n";
+        }
+      }
+    }
+  } catch (const std::exception& EXCEPTION) {
+    std::cout << EXCEPTION.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file differential.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the client code to compare the generated recognizers with the interpreter.
+ * @date 19/10/2026
+ */
+
+#include <filesystem>
+#include <random>
+
+#include "input/PDAInput.hpp"
+#include "generator/GeneratedRecognizer.hpp"
+
+/**
+ * @brief Main function which generates and compiles the recognizer of every given PDA, and runs it, the interpreter of the
+ *        optimized PDA and the interpreter of the PDA as read on the empty string, the input strings given with --input and
+ *        random input strings. It reports every input string where an optimized side disagrees with the PDA as read, or
+ *        where the recognizer and the optimized interpreter differ in their outcome or their number of transitions.
+ * @return 0 if every side matches, 1 otherwise.
+ */
+int main(const int ARGC, const char* ARGV[]) {
+  const std::string USAGE{"Usage: " + std::string{ARGV[0]} + " [--seed <Seed>] [--inputs <Inputs>] [--max-length <Length>]"
+                          " [--max-transitions <Transitions>] [--work <Directory>] [--input <String>]... <PDAFileName>..."};
+  unsigned seed{1};
+  unsigned inputsCount{200};
+  unsigned maxLength{8};
+  unsigned maxTransitions{20000};
+  std::string workDirectory;
+  std::vector<std::string> fixedInputs{""};
+  int argument{1};
+  try {
+    workDirectory = std::filesystem::temp_directory_path().string();
+    for (; argument + 1 < ARGC && ARGV[argument][0] == '-' && ARGV[argument][1] == '-'; argument += 2) {
+      const std::string OPTION{ARGV[argument]};
+      if (OPTION == "--seed") {
+        seed = std::stoul(ARGV[argument + 1]);
+      } else if (OPTION == "--inputs") {
+        inputsCount = std::stoul(ARGV[argument + 1]);
+      } else if (OPTION == "--max-length") {
+        maxLength = std::stoul(ARGV[argument + 1]);
+      } else if (OPTION == "--max-transitions") {
+        maxTransitions = std::stoul(ARGV[argument + 1]);
+      } else if (OPTION == "--work") {
+        workDirectory = ARGV[argument + 1];
+      } else if (OPTION == "--input") {
+        fixedInputs.emplace_back(ARGV[argument + 1]);
+      } else {
+        throw std::invalid_argument{"Unknown option '" + OPTION + "'"};
+      }
+    }
+  } catch (const std::exception&) {
+    std::cerr << USAGE << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (argument == ARGC) {
+    std::cerr << USAGE << std::endl;
+    return EXIT_FAILURE;
+  }
+  const auto OUTCOME_TO_STRING{[](const RecognizerOutcome OUTCOME, const unsigned TRANSITIONS) {
+    const std::string NAMES[]{"Rejected", "Accepted", "Maximum number of transitions reached", "Invalid symbol"};
+    return NAMES[static_cast<int>(OUTCOME)] + " (" + std::to_string(TRANSITIONS) + " transitions)";
+  }};
+  const auto RUN_INTERPRETER{[](PDA& automaton, const std::string& INPUT) {
+    RecognizerOutcome outcome{RecognizerOutcome::LIMIT};
+    try {
+      outcome = automaton.Accepts(INPUT) ? RecognizerOutcome::ACCEPTED : RecognizerOutcome::REJECTED;
+    } catch (const std::invalid_argument&) {
+      outcome = RecognizerOutcome::INVALID;
+    } catch (const std::runtime_error&) {}
+    return RecognizerResult{outcome, outcome == RecognizerOutcome::INVALID ? 0 : automaton.TransitionCounter()};
+  }};
+  // Outcomes where the maximum number of transitions was reached are inconclusive against the reference.
+  const auto DISAGREE{[](const RecognizerOutcome ONE, const RecognizerOutcome OTHER) {
+    return ONE != RecognizerOutcome::LIMIT && OTHER != RecognizerOutcome::LIMIT && ONE != OTHER;
+  }};
+  std::mt19937 random{seed};
+  size_t mismatches{0};
+  try {
+    for (int i{argument}; i < ARGC; ++i) {
+      const std::string FILE_NAME{ARGV[i]};
+      // The reference runs the PDA as read, so bugs of the optimizer are not shared by every side.
+      PDA reference{PDAInput::ReadPDA(FILE_NAME)};
+      reference.SetMaxTransitions(maxTransitions);
+      // Optimizing the PDA as the generator does, so the recognizer and the interpreter process the same transitions.
+      PDA pda{PDAInput::ReadPDA(FILE_NAME)};
+      pda.SetMaxTransitions(maxTransitions);
+      pda.Optimize();
+      // The empty symbol cannot appear in input strings, so it is only checked through --input.
+      std::vector<Symbol> symbols;
+      std::copy_if(pda.InputAlphabet().begin(), pda.InputAlphabet().end(), std::back_inserter(symbols), [](const Symbol& SYMBOL) { return SYMBOL != Symbol::EPSILON; });
+      std::uniform_int_distribution<unsigned> length{0, symbols.empty() ? 0 : maxLength};
+      std::uniform_int_distribution<size_t> symbolChoice{0, symbols.empty() ? 0 : symbols.size() - 1};
+      std::vector<std::string> inputs{fixedInputs};
+      while (inputs.size() < fixedInputs.size() + inputsCount) {
+        std::string input;
+        for (unsigned j{length(random)}; j > 0; --j) {
+          input += symbols[symbolChoice(random)].Value();
+        }
+        inputs.emplace_back(input);
+      }
+      const GeneratedRecognizer RECOGNIZER{pda, workDirectory + "/recognizer-" + std::to_string(i)};
+      const std::vector<RecognizerResult> RESULTS{RECOGNIZER.Run(inputs)};
+      size_t fileMismatches{0};
+      for (size_t j{0}; j < inputs.size(); ++j) {
+        const RecognizerResult EXPECTED{RUN_INTERPRETER(reference, inputs[j])};
+        const RecognizerResult OPTIMIZED{RUN_INTERPRETER(pda, inputs[j])};
+        const RecognizerResult& GENERATED{RESULTS[j]};
+        // Both sides of the optimized PDA must agree with the reference, and the recognizer must process the same transitions.
+        if (DISAGREE(EXPECTED.outcome, OPTIMIZED.outcome) || DISAGREE(EXPECTED.outcome, GENERATED.outcome)
+            || OPTIMIZED.outcome != GENERATED.outcome || OPTIMIZED.transitions != GENERATED.transitions) {
+          ++fileMismatches;
+          std::cout << "--> Mismatch on input string '" << inputs[j] << "': reference " << OUTCOME_TO_STRING(EXPECTED.outcome, EXPECTED.transitions)
+                    << ", optimized " << OUTCOME_TO_STRING(OPTIMIZED.outcome, OPTIMIZED.transitions)
+                    << ", recognizer " << OUTCOME_TO_STRING(GENERATED.outcome, GENERATED.transitions) << "\n";
+        }
+      }
+      std::cout << FILE_NAME << ": " << inputs.size() << " input strings, " << fileMismatches << " mismatches\n";
+      mismatches += fileMismatches;
+    }
+  } catch (const std::exception& EXCEPTION) {
+    std::cerr << EXCEPTION.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
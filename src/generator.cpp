@@ -0,0 +1,36 @@
+/**
+ * @file generator.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the client code to generate a specialized recognizer from a PDA file.
+ * @date 19/10/2026
+ */
+
+#include "input/PDAInput.hpp"
+#include "generator/PDACodeGenerator.hpp"
+
+/**
+ * @brief Main function which reads a PDA from a file and writes the source of its specialized recognizer.
+ * @return 0 on success, 1 on failure.
+ */
+int main(const int ARGC, const char* ARGV[]) {
+  if (ARGC != 3) {
+    std::cerr << "Usage: " << ARGV[0] << " <PDAFileName> <OutputFileName>" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string FILE_NAME{ARGV[1]};
+  const std::string OUTPUT_FILE_NAME{ARGV[2]};
+  try {
+    PDA pda{PDAInput::ReadPDA(FILE_NAME)};
+    std::cout << "PDA loaded from file " + FILE_NAME;
+    std::cout << "\n" << pda.Optimize();
+    std::ofstream writer{OUTPUT_FILE_NAME};
+    if (!writer.is_open()) {
+      throw std::invalid_argument{"Writing file error: File '" + OUTPUT_FILE_NAME + "' could not be opened"};
+    }
+    writer << PDACodeGenerator::Generate(pda, FILE_NAME);
+    std::cout << "\nRecognizer written to file " + OUTPUT_FILE_NAME << std::endl;
+  } catch (const std::exception& EXCEPTION) {
+    std::cout << EXCEPTION.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
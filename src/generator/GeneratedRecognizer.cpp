@@ -0,0 +1,91 @@
+/**
+ * @file GeneratedRecognizer.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to compile and run the generated recognizer of a PDA.
+ * @date 19/10/2026
+ */
+
+#include "GeneratedRecognizer.hpp"
+
+/**
+ * @brief Constructs a new GeneratedRecognizer object, generating and compiling the recognizer of a PDA.
+ * 
+ * @param AUTOMATON PDA to generate the recognizer for. Its maximum number of transitions is written in the recognizer.
+ * @param BASE_NAME Path of the files of the recognizer, without extension.
+ * @throw std::runtime_error If the source cannot be written or compiled.
+ */
+GeneratedRecognizer::GeneratedRecognizer(const PDA& AUTOMATON, const std::string& BASE_NAME) : baseName(BASE_NAME) {
+  std::ofstream writer{baseName + ".cpp"};
+  if (!writer.is_open()) {
+    throw std::runtime_error{"Generator error: File '" + baseName + ".cpp' could not be written"};
+  }
+  writer << PDACodeGenerator::Generate(AUTOMATON, baseName);
+  writer.close();
+  const char* COMPILER{std::getenv("CXX")};
+  const std::string COMMAND{std::string{COMPILER != nullptr && *COMPILER != '\0' ? COMPILER : "g++"} + " -std=c++17 -O1 -DPDA_GENERATED_CHECK -o "
+                            + Quote(baseName + ".exe") + " " + Quote(baseName + ".cpp")};
+  if (std::system(COMMAND.c_str()) != 0) {
+    throw std::runtime_error{"Generator error: Recognizer could not be compiled (" + COMMAND + ")"};
+  }
+}
+
+/**
+ * @brief Runs the recognizer on some input strings, in a single process.
+ * 
+ * @param INPUTS Input strings to check. They cannot contain line breaks.
+ * @return The outcome and the transitions processed for each input string.
+ * @throw std::runtime_error If the recognizer cannot be run or its output is incomplete.
+ */
+std::vector<RecognizerResult> GeneratedRecognizer::Run(const std::vector<std::string>& INPUTS) const {
+  std::ofstream writer{baseName + ".in"};
+  for (const std::string& INPUT : INPUTS) {
+    writer << INPUT << "\n";
+  }
+  writer.close();
+  const std::string COMMAND{Quote(baseName + ".exe") + " < " + Quote(baseName + ".in") + " > " + Quote(baseName + ".out")};
+  if (std::system(COMMAND.c_str()) != 0) {
+    throw std::runtime_error{"Generator error: Recognizer could not be run (" + COMMAND + ")"};
+  }
+  std::ifstream reader{baseName + ".out"};
+  std::vector<RecognizerResult> results;
+  char outcome;
+  unsigned transitions;
+  while (results.size() < INPUTS.size() && reader >> outcome >> transitions) {
+    switch (outcome) {
+      case 'A':
+        results.emplace_back(RecognizerResult{RecognizerOutcome::ACCEPTED, transitions});
+        break;
+      case 'R':
+        results.emplace_back(RecognizerResult{RecognizerOutcome::REJECTED, transitions});
+        break;
+      case 'L':
+        results.emplace_back(RecognizerResult{RecognizerOutcome::LIMIT, transitions});
+        break;
+      default:
+        results.emplace_back(RecognizerResult{RecognizerOutcome::INVALID, transitions});
+    }
+  }
+  if (results.size() != INPUTS.size()) {
+    throw std::runtime_error{"Generator error: Recognizer answered " + std::to_string(results.size()) + " of " + std::to_string(INPUTS.size()) + " input strings"};
+  }
+  return results;
+}
+
+/**
+ * @brief Destroys the GeneratedRecognizer object, removing the files of the recognizer.
+ */
+GeneratedRecognizer::~GeneratedRecognizer() {
+  for (const char* EXTENSION : {".cpp", ".exe", ".in", ".out"}) {
+    std::remove((baseName + EXTENSION).c_str());
+  }
+}
+
+/**
+ * @brief Quotes a path for the command line.
+ * 
+ * @param PATH Path to quote.
+ * @return The quoted path.
+ */
+std::string GeneratedRecognizer::Quote(const std::string& PATH) {
+  return "\"" + PATH + "\"";
+}
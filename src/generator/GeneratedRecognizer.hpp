@@ -0,0 +1,44 @@
+/**
+ * @file GeneratedRecognizer.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to compile and run the generated recognizer of a PDA.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "PDACodeGenerator.hpp"
+
+/**
+ * @brief Outcome of the generated recognizer on an input string.
+ */
+enum class RecognizerOutcome { REJECTED, ACCEPTED, LIMIT, INVALID };
+
+/**
+ * @brief Result of the generated recognizer on an input string.
+ */
+struct RecognizerResult {
+  RecognizerOutcome outcome;
+  unsigned transitions;
+};
+
+/**
+ * @brief Class to compile the generated recognizer of a PDA and run it on input strings, so it can be compared with the
+ *        interpreter. The source is generated with PDACodeGenerator and compiled with PDA_GENERATED_CHECK defined, using
+ *        the compiler of the CXX environment variable (g++ by default). Its files are removed when the object is destroyed.
+ */
+class GeneratedRecognizer {
+  public:
+    GeneratedRecognizer(const PDA&, const std::string&);
+    GeneratedRecognizer(const GeneratedRecognizer&) = delete;
+    GeneratedRecognizer& operator=(const GeneratedRecognizer&) = delete;
+    std::vector<RecognizerResult> Run(const std::vector<std::string>&) const;
+    ~GeneratedRecognizer();
+  private:
+    std::string baseName;
+    static std::string Quote(const std::string&);
+};
@@ -0,0 +1,268 @@
+/**
+ * @file PDACodeGenerator.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to generate a specialized C++ recognizer from a PDA.
+ * @date 19/10/2026
+ */
+
+#include "PDACodeGenerator.hpp"
+
+/**
+ * @brief Generates the source of the recognizer of a PDA.
+ * 
+ * @param AUTOMATON PDA to generate the recognizer for.
+ * @param SOURCE_NAME Name of the file the PDA was read from, written in the header of the generated source.
+ * @return The generated C++ source.
+ */
+std::string PDACodeGenerator::Generate(const PDA& AUTOMATON, const std::string& SOURCE_NAME) {
+  // Numbering the states in the order of the map, so the generated source is stable between runs.
+  std::map<const State*, unsigned> stateIds;
+  for (const auto& STATE : AUTOMATON.States()) {
+    stateIds.emplace(STATE.second, static_cast<unsigned>(stateIds.size()));
+  }
+  std::stringstream source;
+  source << "/**\n";
+  source << " * @file Generated recognizer.\n";
+  source << " * @brief Specialized recognizer of the PDA defined in '" << SOURCE_NAME << "'. Generated code, do not edit.\n";
+  source << " */\n\n";
+  source << "#include <cstddef>\n#include <cstdlib>\n#include <deque>\n#include <iostream>\n#include <stdexcept>\n#include <string>\n#include <utility>\n\n";
+  source << "namespace generated_pda {\n\n";
+  GenerateTables(source, AUTOMATON, stateIds);
+  source << "/**\n * @brief Configuration of the PDA. The top of the stack is the last character.\n */\n";
+  source << "struct Configuration {\n  unsigned state;\n  std::size_t position;\n  std::string stack;\n};\n\n";
+  source << "/**\n * @brief Number of transitions processed by the last call to accepts.\n */\n";
+  source << "unsigned transitionCounter = 0;\n\n";
+  source << "/**\n * @brief Checks if the PDA accepts a given input string.\n *\n";
+  source << " * @param input Input string to check.\n * @return true If the PDA accepts the input string.\n";
+  source << " * @throw std::invalid_argument If a symbol of the input string is not in the PDA alphabet.\n";
+  source << " * @throw std::runtime_error If the maximum number of transitions is reached.\n */\n";
+  source << "bool accepts(const std::string& input) {\n";
+  source << "  std::string symbols(input.size(), '\\0');\n";
+  source << "  for (std::size_t i = 0; i < input.size(); ++i) {\n";
+  source << "    symbols[i] = INPUT_CLASS[static_cast<unsigned char>(input[i])];\n";
+  source << "    if (symbols[i] == '\\0') {\n";
+  source << "      throw std::invalid_argument{\"Runtime error: Symbol: '\" + std::string(1, input[i]) + \"' not found in PDA alphabet ( \" + ALPHABET_STR + \")\"};\n";
+  source << "    }\n  }\n";
+  source << "  std::deque<Configuration> pending;\n";
+  source << "  pending.push_back(Configuration{INITIAL_STATE, 0, std::string(1, INITIAL_STACK_SYMBOL)});\n";
+  source << "  transitionCounter = 0;\n";
+  source << "  while (!pending.empty()) {\n";
+  source << "    ++transitionCounter;\n";
+  source << "    Configuration current{std::move(pending.front())};\n";
+  source << "    pending.pop_front();\n";
+  source << "    const bool consumed{current.position == symbols.size()};\n";
+  source << "    if (current.stack.empty()) {\n      if (consumed) {\n        return true;\n      }\n    } else {\n";
+  GenerateStates(source, AUTOMATON, stateIds);
+  source << "    }\n";
+  source << "    if (transitionCounter == MAX_TRANSITIONS) {\n";
+  source << "      throw std::runtime_error{\"Runtime error: Maximum number of transitions reached.\"};\n";
+  source << "    }\n  }\n  return false;\n}\n\n";
+  source << "} // namespace generated_pda\n";
+  GenerateMain(source);
+  return source.str();
+}
+
+/**
+ * @brief Generates the constexpr tables of the recognizer.
+ * 
+ * @param source Stream to write the generated code to.
+ * @param AUTOMATON PDA to generate the tables for.
+ * @param STATE_IDS Number of each state in the generated code.
+ */
+void PDACodeGenerator::GenerateTables(std::stringstream& source, const PDA& AUTOMATON, const std::map<const State*, unsigned>& STATE_IDS) {
+  const Alphabet& INPUT_ALPHABET{AUTOMATON.InputAlphabet()};
+  std::array<char, 256> inputClass;
+  inputClass.fill('\0');
+  std::string alphabetStr;
+  for (const Symbol& SYMBOL : INPUT_ALPHABET) {
+    // The empty symbol keeps no class, as it cannot appear in input strings.
+    if (SYMBOL == Symbol::EPSILON) {
+      continue;
+    }
+    inputClass[static_cast<unsigned char>(SYMBOL.Value())] = AUTOMATON.Classes().Translate(SYMBOL.ToString())[0].Value();
+    alphabetStr += SYMBOL.ToString() + " ";
+  }
+  source << "/**\n * @brief Input alphabet, as shown in error messages.\n */\n";
+  source << "constexpr char ALPHABET_STR[] = " << StringLiteral(alphabetStr) << ";\n\n";
+  source << "/**\n * @brief Representative symbol of the class of each character, or '\\0' if it is not in the input alphabet.\n */\n";
+  source << "constexpr char INPUT_CLASS[256] = {";
+  for (size_t i{0}; i < inputClass.size(); ++i) {
+    source << (i % 16 == 0 ? "\n  " : " ") << CharLiteral(inputClass[i]) << ",";
+  }
+  source << "\n};\n\n";
+  source << "constexpr unsigned INITIAL_STATE = " << STATE_IDS.at(AUTOMATON.InitialState()) << "; // " << AUTOMATON.InitialState()->ToString() << "\n";
+  source << "constexpr char INITIAL_STACK_SYMBOL = " << CharLiteral(AUTOMATON.InitialStack().Top().Value()) << ";\n";
+  source << "constexpr unsigned MAX_TRANSITIONS = " << AUTOMATON.MaxTransitions() << ";\n\n";
+}
+
+/**
+ * @brief Generates the switch over the states, stack tops and input symbols with the hard-coded transitions. The successors
+ *        are queued in the same order as PDA::Accepts: first the transitions consuming the symbol, then the epsilon ones.
+ *        The stack top is only declared if some state has transitions, and the input symbol is only read by the stack tops
+ *        with transitions consuming it, so the generated code has no unused variables.
+ * 
+ * @param source Stream to write the generated code to.
+ * @param AUTOMATON PDA to generate the transitions for.
+ * @param STATE_IDS Number of each state in the generated code.
+ */
+void PDACodeGenerator::GenerateStates(std::stringstream& source, const PDA& AUTOMATON, const std::map<const State*, unsigned>& STATE_IDS) {
+  std::stringstream cases;
+  for (const auto& STATE : AUTOMATON.States()) {
+    // Reorganizing the transitions of the state by stack top first.
+    std::map<Symbol, std::map<Symbol, std::vector<TransitionResult>>> byStackTop;
+    for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+      for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+        if (!STACK_TRANSITIONS.second.empty()) {
+          byStackTop[STACK_TRANSITIONS.first][INPUT_TRANSITIONS.first] = STACK_TRANSITIONS.second;
+        }
+      }
+    }
+    if (byStackTop.empty()) {
+      continue;
+    }
+    cases << "        case " << STATE_IDS.at(STATE.second) << ": // " << STATE.first << "\n";
+    cases << "          switch (top) {\n";
+    for (const auto& TOP_TRANSITIONS : byStackTop) {
+      cases << "            case " << CharLiteral(TOP_TRANSITIONS.first.Value()) << ":\n";
+      bool hasConsumingTransitions{false};
+      for (const auto& INPUT_TRANSITIONS : TOP_TRANSITIONS.second) {
+        hasConsumingTransitions = hasConsumingTransitions || INPUT_TRANSITIONS.first != Symbol::EPSILON;
+      }
+      if (hasConsumingTransitions) {
+        cases << "              if (!consumed) {\n";
+        cases << "                switch (symbols[current.position]) {\n";
+        for (const auto& INPUT_TRANSITIONS : TOP_TRANSITIONS.second) {
+          if (INPUT_TRANSITIONS.first == Symbol::EPSILON) {
+            continue;
+          }
+          cases << "                  case " << CharLiteral(INPUT_TRANSITIONS.first.Value()) << ":\n";
+          for (const TransitionResult& RESULT : INPUT_TRANSITIONS.second) {
+            cases << "                    pending.push_back(Configuration{" << STATE_IDS.at(std::get<0>(RESULT)) << ", current.position + 1, " << PushedStack(std::get<1>(RESULT)) << "});\n";
+          }
+          cases << "                    break;\n";
+        }
+        cases << "                }\n";
+        cases << "              }\n";
+      }
+      const auto EPSILON_TRANSITIONS{TOP_TRANSITIONS.second.find(Symbol::EPSILON)};
+      if (EPSILON_TRANSITIONS != TOP_TRANSITIONS.second.end()) {
+        for (const TransitionResult& RESULT : EPSILON_TRANSITIONS->second) {
+          cases << "              pending.push_back(Configuration{" << STATE_IDS.at(std::get<0>(RESULT)) << ", current.position, " << PushedStack(std::get<1>(RESULT)) << "});\n";
+        }
+      }
+      cases << "              break;\n";
+    }
+    cases << "          }\n";
+    cases << "          break;\n";
+  }
+  // Without transitions, every configuration with a non-empty stack is dropped, so nothing else is generated.
+  if (cases.str().empty()) {
+    return;
+  }
+  source << "      const char top{current.stack.back()};\n";
+  source << "      current.stack.pop_back();\n";
+  source << "      switch (current.state) {\n";
+  source << cases.str();
+  source << "      }\n";
+}
+
+/**
+ * @brief Generates the optional main functions of the recognizer: one which behaves like the interactive loop of the
+ *        interpreter, and one which prints the outcome of every input line for differential checks.
+ * 
+ * @param source Stream to write the generated code to.
+ */
+void PDACodeGenerator::GenerateMain(std::stringstream& source) {
+  source << "\n#ifdef PDA_GENERATED_MAIN\n";
+  source << "int main() {\n";
+  source << "  try {\n";
+  source << "    for (std::string input; std::getline(std::cin, input) && !input.empty();) {\n";
+  source << "      std::cout << (generated_pda::accepts(input) ? \"--> Accepted\\n\" : \"--> Rejected\\n\");\n";
+  source << "      std::cout << \"Transitions processed: \" << generated_pda::transitionCounter << \"\\n\";\n";
+  source << "    }\n";
+  source << "  } catch (const std::exception& EXCEPTION) {\n";
+  source << "    std::cout << EXCEPTION.what() << std::endl;\n";
+  source << "    return EXIT_FAILURE;\n";
+  source << "  }\n";
+  source << "}\n";
+  source << "#endif\n";
+  source << "\n#ifdef PDA_GENERATED_CHECK\n";
+  source << "int main() {\n";
+  source << "  // One line per input string, including empty ones: A (accepted), R (rejected), L (maximum number of transitions\n";
+  source << "  // reached) or E (symbol not in the alphabet), followed by the transitions processed.\n";
+  source << "  for (std::string input; std::getline(std::cin, input);) {\n";
+  source << "    char outcome;\n";
+  source << "    try {\n";
+  source << "      outcome = generated_pda::accepts(input) ? 'A' : 'R';\n";
+  source << "    } catch (const std::invalid_argument&) {\n";
+  source << "      outcome = 'E';\n";
+  source << "      generated_pda::transitionCounter = 0;\n";
+  source << "    } catch (const std::runtime_error&) {\n";
+  source << "      outcome = 'L';\n";
+  source << "    }\n";
+  source << "    std::cout << outcome << ' ' << generated_pda::transitionCounter << '\\n';\n";
+  source << "  }\n";
+  source << "}\n";
+  source << "#endif\n";
+}
+
+/**
+ * @brief Converts a character to a C++ character literal.
+ * 
+ * @param VALUE Character to convert.
+ * @return The character literal.
+ */
+std::string PDACodeGenerator::CharLiteral(const char VALUE) {
+  if (VALUE == '\0') {
+    return "'\\0'";
+  }
+  if (VALUE == '\'' || VALUE == '\\') {
+    return std::string{"'\\"} + VALUE + "'";
+  }
+  return std::string{"'"} + VALUE + "'";
+}
+
+/**
+ * @brief Returns the expression of the stack after a transition pushes its symbols.
+ * 
+ * @param SYMBOLS Symbols pushed by the transition.
+ * @return The expression of the new stack.
+ */
+std::string PDACodeGenerator::PushedStack(const std::vector<Symbol>& SYMBOLS) {
+  const std::string LITERAL{StackLiteral(SYMBOLS)};
+  return LITERAL == "\"\"" ? "current.stack" : "current.stack + " + LITERAL;
+}
+
+/**
+ * @brief Converts a string to a C++ string literal.
+ * 
+ * @param VALUE String to convert.
+ * @return The string literal.
+ */
+std::string PDACodeGenerator::StringLiteral(const std::string& VALUE) {
+  std::string literal{"\""};
+  for (const char CHARACTER : VALUE) {
+    if (CHARACTER == '"' || CHARACTER == '\\') {
+      literal += '\\';
+    }
+    literal += CHARACTER;
+  }
+  return literal + "\"";
+}
+
+/**
+ * @brief Converts the symbols pushed by a transition to a C++ string literal to append to the stack. As the top of the
+ *        generated stack is its last character, the symbols are reversed and the empty symbols are removed.
+ * 
+ * @param SYMBOLS Symbols pushed by the transition, the first one ending on top.
+ * @return The string literal.
+ */
+std::string PDACodeGenerator::StackLiteral(const std::vector<Symbol>& SYMBOLS) {
+  std::string stackSymbols;
+  for (auto it{SYMBOLS.rbegin()}; it != SYMBOLS.rend(); ++it) {
+    if (*it != Symbol::EPSILON) {
+      stackSymbols += it->Value();
+    }
+  }
+  return StringLiteral(stackSymbols);
+}
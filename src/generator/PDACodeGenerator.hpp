@@ -0,0 +1,38 @@
+/**
+ * @file PDACodeGenerator.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to generate a specialized C++ recognizer from a PDA.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <sstream>
+
+#include "../structure/PDA.hpp"
+
+/**
+ * @brief Class to generate a standalone C++ source with a specialized recognizer for a PDA. The generated source defines
+ *        the function 'bool generated_pda::accepts(const std::string&)', with the same semantics as PDA::Accepts:
+ * 
+ *        - States are the cases of a switch and transitions are hard-coded per stack top and input symbol.
+ * 
+ *        - The input alphabet and its equivalence classes are constexpr tables.
+ * 
+ *        - Compiling the source with PDA_GENERATED_MAIN defined adds a main function which reads input strings from console.
+ * 
+ *        - Compiling the source with PDA_GENERATED_CHECK defined adds instead a main function which prints the outcome and
+ *          the transitions of every input line, used by GeneratedRecognizer to compare it with the interpreter.
+ */
+class PDACodeGenerator {
+  public:
+    static std::string Generate(const PDA&, const std::string&);
+  private:
+    static void GenerateTables(std::stringstream&, const PDA&, const std::map<const State*, unsigned>&);
+    static void GenerateStates(std::stringstream&, const PDA&, const std::map<const State*, unsigned>&);
+    static void GenerateMain(std::stringstream&);
+    static std::string CharLiteral(char);
+    static std::string PushedStack(const std::vector<Symbol>&);
+    static std::string StringLiteral(const std::string&);
+    static std::string StackLiteral(const std::vector<Symbol>&);
+};
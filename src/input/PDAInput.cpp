@@ -24,6 +24,17 @@ PDA PDAInput::ReadPDA(const std::string& FILENAME) {
   if (!reader.is_open()) {
     throw std::invalid_argument{"Reading file error: File '" + FILENAME + "' not found"};
   }
+  return ReadPDA(reader);
+}
+
+/**
+ * @brief Reads a PDA from a stream, with the same format as the files.
+ * 
+ * @param reader Stream to read the PDA from.
+ * @return The PDA read from the stream.
+ * @throw std::invalid_argument If the PDA specified in the stream is invalid.
+ */
+PDA PDAInput::ReadPDA(std::istream& reader) {
   std::vector<std::string> rawLines;
   for (std::string line; std::getline(reader, line);) {
     rawLines.emplace_back(line);
@@ -34,6 +34,7 @@ class PDAInput {
     const static char COMMENT_SYMBOL;
 
     static PDA ReadPDA(const std::string&);
+    static PDA ReadPDA(std::istream&);
   private:
     static void AddTransition(std::map<std::string, State*>&, const std::string&, const Alphabet&, const Alphabet&);
     static std::string AlphabetFormatting(const Alphabet&);
@@ -12,8 +12,8 @@
  * @return 0 on success, 1 on failure.
  */
 int main(const int ARGC, const char* ARGV[]) {
-  if (ARGC != 2) {
-    std::cerr << "Usage: " << ARGV[0] << " <PDAFileName>" << std::endl;
+  if (ARGC != 2 && ARGC != 3) {
+    std::cerr << "Usage: " << ARGV[0] << " <PDAFileName> [CacheBytes]" << std::endl;
     return EXIT_FAILURE;
   }
   const std::string FILE_NAME{ARGV[1]};
@@ -21,6 +21,13 @@ int main(const int ARGC, const char* ARGV[]) {
     PDA pda{PDAInput::ReadPDA(FILE_NAME)};
     pda.EnableTrace(); // Comment this line to disable trace
     std::cout << "PDA loaded from file " + FILE_NAME;
+    std::cout << "\n" << pda.Optimize();
+    // Caching the results of repeated input strings if a memory cap is given.
+    std::shared_ptr<ResultCache> cache;
+    if (ARGC == 3) {
+      cache = std::make_shared<ResultCache>(std::stoul(ARGV[2]));
+      pda.SetCache(cache);
+    }
     std::string input;
     std::cout << "\nReading input strings from console (empty string to exit)...\n";
     while (true) { 
@@ -36,6 +43,9 @@ int main(const int ARGC, const char* ARGV[]) {
         break;
       }
     }
+    if (cache != nullptr) {
+      std::cout << "Cache hits: " << cache->Hits() << ", misses: " << cache->Misses() << ", hit rate: " << cache->HitRate() << "\n";
+    }
   } catch (const std::exception& EXCEPTION) {
     std::cout << EXCEPTION.what() << std::endl;
     return EXIT_FAILURE;
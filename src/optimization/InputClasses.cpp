@@ -0,0 +1,135 @@
+/**
+ * @file InputClasses.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to group the input symbols of a PDA into equivalence classes.
+ * @date 19/10/2026
+ */
+
+#include "InputClasses.hpp"
+
+/**
+ * @brief Class value of the characters that are not in the input alphabet.
+ */
+const int16_t InputClasses::NO_CLASS{-1};
+
+/**
+ * @brief Type to represent the behaviour of an input symbol: the transitions of every state which has any for that symbol.
+ */
+using SymbolBehaviour = std::vector<std::pair<const State*, std::map<Symbol, std::vector<TransitionResult>>>>;
+
+/**
+ * @brief Constructs a new InputClasses object where every symbol forms its own class.
+ * 
+ * @param ALPHABET Alphabet of the input symbols.
+ */
+InputClasses::InputClasses(const Alphabet& ALPHABET) : alphabet(ALPHABET) {
+  classOf.fill(NO_CLASS);
+  for (const Symbol& SYMBOL : alphabet) {
+    AddToClass(SYMBOL, representatives.size());
+  }
+}
+
+/**
+ * @brief Constructs a new InputClasses object, grouping the symbols with identical transitions in every state.
+ * 
+ * @param STATES Map of states of the PDA.
+ * @param ALPHABET Alphabet of the input symbols.
+ */
+InputClasses::InputClasses(const std::map<std::string, State*>& STATES, const Alphabet& ALPHABET) : alphabet(ALPHABET) {
+  classOf.fill(NO_CLASS);
+  std::map<SymbolBehaviour, size_t> classes;
+  for (const Symbol& SYMBOL : alphabet) {
+    if (SYMBOL == Symbol::EPSILON) {
+      AddToClass(SYMBOL, representatives.size());
+      continue;
+    }
+    SymbolBehaviour behaviour;
+    for (const auto& STATE : STATES) {
+      const TransitionMap& TRANSITIONS{STATE.second->Transitions().Entries()};
+      const auto INPUT_TRANSITIONS{TRANSITIONS.find(SYMBOL)};
+      if (INPUT_TRANSITIONS == TRANSITIONS.end()) {
+        continue;
+      }
+      // Ignoring the stack tops left without transitions by the optimization passes.
+      std::map<Symbol, std::vector<TransitionResult>> stackTransitions;
+      std::copy_if(INPUT_TRANSITIONS->second.begin(), INPUT_TRANSITIONS->second.end(), std::inserter(stackTransitions, stackTransitions.end()),
+                   [](const std::pair<const Symbol, std::vector<TransitionResult>>& PAIR) { return !PAIR.second.empty(); });
+      if (!stackTransitions.empty()) {
+        behaviour.emplace_back(STATE.second, stackTransitions);
+      }
+    }
+    const auto FOUND_CLASS{classes.find(behaviour)};
+    if (FOUND_CLASS == classes.end()) {
+      classes.emplace(behaviour, representatives.size());
+      AddToClass(SYMBOL, representatives.size());
+    } else {
+      AddToClass(SYMBOL, FOUND_CLASS->second);
+    }
+  }
+}
+
+/**
+ * @brief Removes the transitions of the symbols which are not the representative of their class.
+ * 
+ * @param states Map of states of the PDA.
+ */
+void InputClasses::Compress(std::map<std::string, State*>& states) const {
+  for (const auto& STATE : states) {
+    TransitionMap& transitions{STATE.second->Transitions().Entries()};
+    for (auto it{transitions.begin()}; it != transitions.end();) {
+      const int16_t CLASS{classOf[static_cast<unsigned char>(it->first.Value())]};
+      if (CLASS != NO_CLASS && representatives[CLASS] != it->first) {
+        it = transitions.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Translates an input string into the representative symbols of the classes of its symbols.
+ * 
+ * @param INPUT_STR Input string to translate.
+ * @return The representative symbols of the input string.
+ * @throw std::invalid_argument If a symbol of the input string is not in the alphabet or is the empty symbol.
+ */
+std::vector<Symbol> InputClasses::Translate(const std::string& INPUT_STR) const {
+  std::vector<Symbol> symbols;
+  symbols.reserve(INPUT_STR.size());
+  for (const char SYMBOL_VALUE : INPUT_STR) {
+    // Otherwise, collapsing epsilon chains would change which input strings are accepted.
+    if (SYMBOL_VALUE == Symbol::EPSILON.Value()) {
+      throw std::invalid_argument{"Runtime error: The empty symbol '" + Symbol::EPSILON.ToString() + "' cannot appear in an input string"};
+    }
+    const int16_t CLASS{classOf[static_cast<unsigned char>(SYMBOL_VALUE)]};
+    if (CLASS == NO_CLASS) {
+      const std::string ALPHABET_STR{std::accumulate(alphabet.begin(), alphabet.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })};
+      throw std::invalid_argument{"Runtime error: Symbol: '" + Symbol{SYMBOL_VALUE}.ToString() + "' not found in PDA alphabet ( " + ALPHABET_STR + ")"};
+    }
+    symbols.emplace_back(representatives[CLASS]);
+  }
+  return symbols;
+}
+
+/**
+ * @brief Returns the number of classes, including the class of the empty symbol.
+ * 
+ * @return The number of classes.
+ */
+size_t InputClasses::Size() const {
+  return representatives.size();
+}
+
+/**
+ * @brief Adds a symbol to a class. If the class does not exist yet, the symbol becomes its representative.
+ * 
+ * @param SYMBOL Symbol to add.
+ * @param CLASS Class of the symbol.
+ */
+void InputClasses::AddToClass(const Symbol& SYMBOL, const size_t CLASS) {
+  if (CLASS == representatives.size()) {
+    representatives.emplace_back(SYMBOL);
+  }
+  classOf[static_cast<unsigned char>(SYMBOL.Value())] = static_cast<int16_t>(CLASS);
+}
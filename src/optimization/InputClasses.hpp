@@ -0,0 +1,38 @@
+/**
+ * @file InputClasses.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to group the input symbols of a PDA into equivalence classes.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iterator>
+
+#include "../structure/state.hpp"
+#include "../structure/PDAStack.hpp"
+
+/**
+ * @brief Class to group the input symbols of a PDA into equivalence classes. Two symbols are equivalent if every state has
+ *        exactly the same transitions for both of them, so the PDA only needs to keep the transitions of one representative
+ *        symbol per class. Input strings are translated once into representative symbols before running the PDA.
+ *        The empty symbol always forms its own class, but it cannot appear in input strings: epsilon transitions never
+ *        consume input.
+ */
+class InputClasses {
+  public:
+    static const int16_t NO_CLASS;
+
+    InputClasses(const Alphabet&);
+    InputClasses(const std::map<std::string, State*>&, const Alphabet&);
+    void Compress(std::map<std::string, State*>&) const;
+    std::vector<Symbol> Translate(const std::string&) const;
+    size_t Size() const;
+  private:
+    Alphabet alphabet;
+    std::vector<Symbol> representatives;
+    std::array<int16_t, 256> classOf;
+    void AddToClass(const Symbol&, size_t);
+};
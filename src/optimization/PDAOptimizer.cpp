@@ -0,0 +1,223 @@
+/**
+ * @file PDAOptimizer.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to simplify the states and transitions of a PDA.
+ * @date 19/10/2026
+ */
+
+#include "PDAOptimizer.hpp"
+
+/**
+ * @brief Constructs a new PDAOptimizer object.
+ * 
+ * @param givenStates Map of states of the PDA. Removed states are erased from it and freed.
+ * @param givenInitialState Initial state of the PDA, which is never removed.
+ */
+PDAOptimizer::PDAOptimizer(std::map<std::string, State*>& givenStates, State* givenInitialState) : states(givenStates), initialState(givenInitialState) {
+  statesBefore = states.size();
+  transitionsBefore = CountTransitions();
+}
+
+/**
+ * @brief Runs every optimization pass over the PDA.
+ */
+void PDAOptimizer::Run() {
+  RemoveDuplicateTransitions();
+  // Removing first the transitions which can never empty the stack, so they are not collapsed.
+  RemoveNonProductiveTransitions();
+  CollapseEpsilonChains();
+  RemoveNonProductiveTransitions();
+  RemoveUnreachableStates();
+  // Collapsing chains may have produced new duplicates.
+  RemoveDuplicateTransitions();
+}
+
+/**
+ * @brief Returns a report of the size of the PDA before and after the optimization.
+ * 
+ * @return The report of the optimization.
+ */
+std::string PDAOptimizer::Report() const {
+  std::stringstream report;
+  report << "PDA optimized:";
+  report << "\n\tStates: " << statesBefore << " -> " << states.size();
+  report << "\n\tTransitions: " << transitionsBefore << " -> " << CountTransitions();
+  return report.str();
+}
+
+/**
+ * @brief Removes the transitions with the same input symbol, stack top, next state and stack replacement than a previous one.
+ */
+void PDAOptimizer::RemoveDuplicateTransitions() {
+  for (const auto& STATE : states) {
+    for (auto& inputTransitions : STATE.second->Transitions().Entries()) {
+      for (auto& stackTransitions : inputTransitions.second) {
+        std::vector<TransitionResult>& results{stackTransitions.second};
+        std::vector<TransitionResult> uniqueResults;
+        for (const TransitionResult& RESULT : results) {
+          if (std::find(uniqueResults.begin(), uniqueResults.end(), RESULT) == uniqueResults.end()) {
+            uniqueResults.emplace_back(RESULT);
+          }
+        }
+        results = uniqueResults;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Collapses chains of epsilon moves. When a transition leads to a state whose only move with the pushed top is a single
+ *        epsilon transition, the intermediate configuration always has that one successor, so both moves are merged into one.
+ *        Chains are followed over the moves as they were before this pass, and stop at the first state and stack top already
+ *        visited, so epsilon cycles neither loop nor make the pushed symbols grow on every step.
+ */
+void PDAOptimizer::CollapseEpsilonChains() {
+  // Copying the single epsilon moves first, so a chain never goes through transitions already rewritten.
+  std::map<std::pair<const State*, Symbol>, TransitionResult> epsilonMoves;
+  for (const auto& STATE : states) {
+    for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+      for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+        const TransitionResult* MOVE{SingleEpsilonMove(STATE.second, STACK_TRANSITIONS.first)};
+        if (MOVE != nullptr) {
+          epsilonMoves.emplace(std::make_pair(STATE.second, STACK_TRANSITIONS.first), *MOVE);
+        }
+      }
+    }
+  }
+  for (const auto& STATE : states) {
+    for (auto& inputTransitions : STATE.second->Transitions().Entries()) {
+      for (auto& stackTransitions : inputTransitions.second) {
+        for (TransitionResult& result : stackTransitions.second) {
+          // The configuration the transition starts from counts as visited, so it is never collapsed through itself.
+          std::set<std::pair<const State*, Symbol>> visited{std::make_pair(STATE.second, stackTransitions.first)};
+          while (true) {
+            const std::vector<Symbol> PUSHED{WithoutEpsilon(std::get<1>(result))};
+            // If nothing is pushed, the next top is unknown at load time.
+            if (PUSHED.empty()) {
+              break;
+            }
+            const std::pair<const State*, Symbol> NEXT_CONFIGURATION{std::get<0>(result), PUSHED[0]};
+            const auto NEXT_MOVE{epsilonMoves.find(NEXT_CONFIGURATION)};
+            if (NEXT_MOVE == epsilonMoves.end() || !visited.insert(NEXT_CONFIGURATION).second) {
+              break;
+            }
+            std::vector<Symbol> composite{WithoutEpsilon(std::get<1>(NEXT_MOVE->second))};
+            composite.insert(composite.end(), PUSHED.begin() + 1, PUSHED.end());
+            if (composite.empty()) {
+              composite.emplace_back(Symbol::EPSILON);
+            }
+            result = TransitionResult{std::get<0>(NEXT_MOVE->second), composite};
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Removes the transitions which push symbols into a non-productive state. A state is productive if it can pop a symbol
+ *        or move to a productive state; otherwise, once the stack is not empty in that state, it can never be emptied.
+ */
+void PDAOptimizer::RemoveNonProductiveTransitions() {
+  std::set<const State*> productive;
+  bool changed{true};
+  while (changed) {
+    changed = false;
+    for (const auto& STATE : states) {
+      if (productive.count(STATE.second) > 0) {
+        continue;
+      }
+      for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+        for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+          for (const TransitionResult& RESULT : STACK_TRANSITIONS.second) {
+            if (WithoutEpsilon(std::get<1>(RESULT)).empty() || productive.count(std::get<0>(RESULT)) > 0) {
+              changed = productive.insert(STATE.second).second || changed;
+            }
+          }
+        }
+      }
+    }
+  }
+  for (const auto& STATE : states) {
+    for (auto& inputTransitions : STATE.second->Transitions().Entries()) {
+      for (auto& stackTransitions : inputTransitions.second) {
+        std::vector<TransitionResult>& results{stackTransitions.second};
+        results.erase(std::remove_if(results.begin(), results.end(), [&productive](const TransitionResult& RESULT) {
+          return productive.count(std::get<0>(RESULT)) == 0 && !WithoutEpsilon(std::get<1>(RESULT)).empty();
+        }), results.end());
+      }
+    }
+  }
+}
+
+/**
+ * @brief Removes and frees the states which cannot be reached from the initial state.
+ */
+void PDAOptimizer::RemoveUnreachableStates() {
+  std::set<const State*> reachable{initialState};
+  std::vector<const State*> pendantStates{initialState};
+  while (!pendantStates.empty()) {
+    const State* actualState{pendantStates.back()};
+    pendantStates.pop_back();
+    for (const auto& INPUT_TRANSITIONS : actualState->Transitions().Entries()) {
+      for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+        for (const TransitionResult& RESULT : STACK_TRANSITIONS.second) {
+          if (reachable.insert(std::get<0>(RESULT)).second) {
+            pendantStates.emplace_back(std::get<0>(RESULT));
+          }
+        }
+      }
+    }
+  }
+  for (auto it{states.begin()}; it != states.end();) {
+    if (reachable.count(it->second) == 0) {
+      delete it->second;
+      it = states.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+/**
+ * @brief Counts the transitions of every state of the PDA.
+ * 
+ * @return The number of transitions of the PDA.
+ */
+size_t PDAOptimizer::CountTransitions() const {
+  return std::accumulate(states.begin(), states.end(), size_t{0}, [](const size_t ACCOUNT, const std::pair<std::string, State*>& PAIR) { return ACCOUNT + PAIR.second->Transitions().Size(); });
+}
+
+/**
+ * @brief Returns the given symbols without the empty symbols.
+ * 
+ * @param SYMBOLS Symbols to filter.
+ * @return The symbols which are not the empty symbol.
+ */
+std::vector<Symbol> PDAOptimizer::WithoutEpsilon(const std::vector<Symbol>& SYMBOLS) {
+  std::vector<Symbol> result;
+  std::copy_if(SYMBOLS.begin(), SYMBOLS.end(), std::back_inserter(result), [](const Symbol& SYMBOL) { return SYMBOL != Symbol::EPSILON; });
+  return result;
+}
+
+/**
+ * @brief Returns the only move of a state for a given stack top, if that move is an epsilon transition.
+ * 
+ * @param STATE State to check.
+ * @param STACK_TOP Top of the stack.
+ * @return The only move of the state, or nullptr if there are none, several or it consumes input.
+ */
+const TransitionResult* PDAOptimizer::SingleEpsilonMove(const State* STATE, const Symbol& STACK_TOP) {
+  const TransitionResult* move{nullptr};
+  for (const auto& INPUT_TRANSITIONS : STATE->Transitions().Entries()) {
+    const auto STACK_TRANSITIONS{INPUT_TRANSITIONS.second.find(STACK_TOP)};
+    if (STACK_TRANSITIONS == INPUT_TRANSITIONS.second.end() || STACK_TRANSITIONS->second.empty()) {
+      continue;
+    }
+    if (INPUT_TRANSITIONS.first != Symbol::EPSILON || STACK_TRANSITIONS->second.size() > 1 || move != nullptr) {
+      return nullptr;
+    }
+    move = &STACK_TRANSITIONS->second.front();
+  }
+  return move;
+}
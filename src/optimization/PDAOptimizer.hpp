@@ -0,0 +1,47 @@
+/**
+ * @file PDAOptimizer.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to simplify the states and transitions of a PDA.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+#include "../structure/state.hpp"
+
+/**
+ * @brief Class to simplify the graph of states and transitions of a PDA without changing the accepted language. The passes run in this order:
+ * 
+ *        - Duplicate transitions are removed.
+ * 
+ *        - Transitions that push symbols into a state which can never pop are removed.
+ * 
+ *        - Chains of deterministic epsilon moves are collapsed into single composite moves, and the
+ *          transitions pushing into states which can never pop are removed again.
+ * 
+ *        - States unreachable from the initial state are removed and freed.
+ */
+class PDAOptimizer {
+  public:
+    PDAOptimizer(std::map<std::string, State*>&, State*);
+    void Run();
+    std::string Report() const;
+  private:
+    std::map<std::string, State*>& states;
+    State* initialState;
+    size_t statesBefore;
+    size_t transitionsBefore;
+    void RemoveDuplicateTransitions();
+    void CollapseEpsilonChains();
+    void RemoveNonProductiveTransitions();
+    void RemoveUnreachableStates();
+    size_t CountTransitions() const;
+    static std::vector<Symbol> WithoutEpsilon(const std::vector<Symbol>&);
+    static const TransitionResult* SingleEpsilonMove(const State*, const Symbol&);
+};
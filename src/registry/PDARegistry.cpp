@@ -0,0 +1,334 @@
+/**
+ * @file PDARegistry.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to evaluate an input string against many PDAs at once.
+ * @date 19/10/2026
+ */
+
+#include "PDARegistry.hpp"
+
+/**
+ * @brief Checks if a PDA accepts the input string.
+ * 
+ * @param INDEX Index of the PDA in the registry.
+ * @return true If the PDA accepts the input string.
+ * @return false If the PDA does not accept the input string or was not evaluated.
+ */
+bool RegistryResult::IsAccepted(const size_t INDEX) const {
+  return (accepted[INDEX / 64] >> (INDEX % 64)) & 1;
+}
+
+/**
+ * @brief Checks if the evaluation of a PDA failed.
+ * 
+ * @param INDEX Index of the PDA in the registry.
+ * @return true If the input string has symbols outside the alphabet of the PDA or the maximum number of transitions was reached.
+ * @return false If the evaluation of the PDA completed or the PDA was not evaluated.
+ */
+bool RegistryResult::IsFailed(const size_t INDEX) const {
+  return (failed[INDEX / 64] >> (INDEX % 64)) & 1;
+}
+
+/**
+ * @brief Constructs a new PDARegistry object. The empty symbol is always interned first.
+ * 
+ * @param THREADS Number of threads used to evaluate the PDAs. With a single thread they are evaluated on the calling thread.
+ */
+PDARegistry::PDARegistry(const unsigned THREADS) {
+  symbolIds.fill(-1);
+  Intern(Symbol::EPSILON);
+  if (THREADS > 1) {
+    pool = std::make_unique<WorkerPool>(THREADS);
+  }
+}
+
+/**
+ * @brief Reads a PDA from a file, optimizes it and adds it to the registry.
+ * 
+ * @param NAME Name of the PDA.
+ * @param FILENAME Name of the file to read the PDA from.
+ * @return The index of the PDA in the registry.
+ * @throw std::invalid_argument If the file does not exist, the PDA is invalid or the name is already registered.
+ */
+size_t PDARegistry::Load(const std::string& NAME, const std::string& FILENAME) {
+  PDA pda{PDAInput::ReadPDA(FILENAME)};
+  pda.Optimize();
+  return Add(NAME, pda);
+}
+
+/**
+ * @brief Adds a PDA to the registry, copying its transitions into the arenas.
+ * 
+ * @param NAME Name of the PDA.
+ * @param AUTOMATON PDA to add.
+ * @return The index of the PDA in the registry.
+ * @throw std::invalid_argument If the name is already registered or the PDA has too many states.
+ */
+size_t PDARegistry::Add(const std::string& NAME, const PDA& AUTOMATON) {
+  if (indexes.find(NAME) != indexes.end()) {
+    throw std::invalid_argument{"Registry error: PDA '" + NAME + "' already registered"};
+  }
+  if (AUTOMATON.States().size() > 0xFFFF) {
+    throw std::invalid_argument{"Registry error: PDA '" + NAME + "' has more than 65535 states"};
+  }
+  Automaton automaton;
+  automaton.name = NAME;
+  automaton.classOf.fill(0);
+  automaton.maxTransitions = AUTOMATON.MaxTransitions();
+  for (const Symbol& SYMBOL : AUTOMATON.InputAlphabet()) {
+    // The empty symbol is left out of the alphabet, so input strings containing it fail.
+    if (SYMBOL == Symbol::EPSILON) {
+      continue;
+    }
+    const uint8_t ID{Intern(SYMBOL)};
+    automaton.alphabet.set(ID);
+    automaton.classOf[ID] = Intern(AUTOMATON.Classes().Translate(SYMBOL.ToString())[0]);
+  }
+  for (const Symbol& SYMBOL : AUTOMATON.InitialStack().StackAlphabet()) {
+    Intern(SYMBOL);
+  }
+  automaton.initialStackSymbol = Intern(AUTOMATON.InitialStack().Top());
+  std::map<const State*, uint32_t> stateIds;
+  for (const auto& STATE : AUTOMATON.States()) {
+    stateIds.emplace(STATE.second, static_cast<uint32_t>(stateIds.size()));
+  }
+  automaton.initialState = stateIds.at(AUTOMATON.InitialState());
+  // Collecting the transitions of every state by key, so the slice of keys of the PDA is sorted.
+  std::map<uint32_t, const std::vector<TransitionResult>*> byKey;
+  for (const auto& STATE : AUTOMATON.States()) {
+    for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+      for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+        if (!STACK_TRANSITIONS.second.empty()) {
+          byKey.emplace(PackKey(stateIds.at(STATE.second), Intern(INPUT_TRANSITIONS.first), Intern(STACK_TRANSITIONS.first)), &STACK_TRANSITIONS.second);
+        }
+      }
+    }
+  }
+  automaton.keysBegin = keys.size();
+  for (const auto& KEY_TRANSITIONS : byKey) {
+    TransitionKey key{KEY_TRANSITIONS.first, static_cast<uint32_t>(transitions.size()), 0};
+    for (const TransitionResult& RESULT : *KEY_TRANSITIONS.second) {
+      ArenaTransition transition{stateIds.at(std::get<0>(RESULT)), static_cast<uint32_t>(pushArena.size()), 0};
+      const std::vector<Symbol>& PUSHED{std::get<1>(RESULT)};
+      for (auto it{PUSHED.rbegin()}; it != PUSHED.rend(); ++it) {
+        if (*it != Symbol::EPSILON) {
+          pushArena += static_cast<char>(Intern(*it));
+          ++transition.pushLength;
+        }
+      }
+      transitions.emplace_back(transition);
+    }
+    key.end = static_cast<uint32_t>(transitions.size());
+    keys.emplace_back(key);
+  }
+  automaton.keysEnd = keys.size();
+  indexes.emplace(NAME, automata.size());
+  automata.emplace_back(automaton);
+  return automata.size() - 1;
+}
+
+/**
+ * @brief Returns the number of PDAs in the registry.
+ * 
+ * @return The number of PDAs in the registry.
+ */
+size_t PDARegistry::Size() const {
+  return automata.size();
+}
+
+/**
+ * @brief Returns the index of a PDA in the registry.
+ * 
+ * @param NAME Name of the PDA.
+ * @return The index of the PDA.
+ * @throw std::invalid_argument If the name is not registered.
+ */
+size_t PDARegistry::IndexOf(const std::string& NAME) const {
+  const auto FOUND{indexes.find(NAME)};
+  if (FOUND == indexes.end()) {
+    throw std::invalid_argument{"Registry error: PDA '" + NAME + "' not registered"};
+  }
+  return FOUND->second;
+}
+
+/**
+ * @brief Returns the name of a PDA in the registry.
+ * 
+ * @param INDEX Index of the PDA.
+ * @return The name of the PDA.
+ */
+const std::string& PDARegistry::NameOf(const size_t INDEX) const {
+  return automata.at(INDEX).name;
+}
+
+/**
+ * @brief Evaluates an input string against every PDA of the registry.
+ * 
+ * @param INPUT Input string to check.
+ * @return The bitmaps of accepted and failed PDAs, and the transitions processed by each one.
+ */
+RegistryResult PDARegistry::Evaluate(const std::string& INPUT) const {
+  std::vector<size_t> subset(automata.size());
+  std::iota(subset.begin(), subset.end(), size_t{0});
+  return Evaluate(INPUT, subset);
+}
+
+/**
+ * @brief Evaluates an input string against a subset of the PDAs of the registry.
+ * 
+ * @param INPUT Input string to check.
+ * @param SUBSET Indexes of the PDAs to evaluate.
+ * @return The bitmaps of accepted and failed PDAs, and the transitions processed by each one. The PDAs outside the subset
+ *         are left unset.
+ */
+RegistryResult PDARegistry::Evaluate(const std::string& INPUT, const std::vector<size_t>& SUBSET) const {
+  // Converting the input string into interned symbols once for every PDA.
+  std::string inputIds(INPUT.size(), '\0');
+  std::bitset<256> inputSymbols;
+  bool hasUnknownSymbols{false};
+  for (size_t i{0}; i < INPUT.size(); ++i) {
+    const int16_t ID{symbolIds[static_cast<unsigned char>(INPUT[i])]};
+    hasUnknownSymbols = hasUnknownSymbols || ID < 0;
+    inputIds[i] = static_cast<char>(ID < 0 ? 0 : ID);
+    inputSymbols.set(ID < 0 ? 0 : ID);
+  }
+  // Outcome of each PDA of the subset: 0 if rejected, 1 if accepted and 2 if failed.
+  std::vector<char> outcomes(SUBSET.size(), 0);
+  std::vector<unsigned> transitionCounters(SUBSET.size(), 0);
+  const auto EVALUATE_RANGE{[&](const size_t BEGIN, const size_t END) {
+    for (size_t i{BEGIN}; i < END; ++i) {
+      const Automaton& AUTOMATON{automata.at(SUBSET[i])};
+      if (hasUnknownSymbols || (inputSymbols & ~AUTOMATON.alphabet).any()) {
+        outcomes[i] = 2;
+        continue;
+      }
+      bool failed{false};
+      const bool ACCEPTED{Run(AUTOMATON, inputIds, failed, transitionCounters[i])};
+      outcomes[i] = failed ? 2 : ACCEPTED;
+    }
+  }};
+  if (pool == nullptr || SUBSET.size() < 2) {
+    EVALUATE_RANGE(0, SUBSET.size());
+  } else {
+    const size_t CHUNKS{std::min<size_t>(pool->Size(), SUBSET.size())};
+    size_t pendantChunks{CHUNKS};
+    std::mutex mutex;
+    std::condition_variable chunkFinished;
+    for (size_t chunk{0}; chunk < CHUNKS; ++chunk) {
+      pool->Submit([&, chunk](unsigned) {
+        EVALUATE_RANGE(SUBSET.size() * chunk / CHUNKS, SUBSET.size() * (chunk + 1) / CHUNKS);
+        std::lock_guard<std::mutex> lock{mutex};
+        if (--pendantChunks == 0) {
+          chunkFinished.notify_one();
+        }
+      });
+    }
+    std::unique_lock<std::mutex> lock{mutex};
+    chunkFinished.wait(lock, [&]() { return pendantChunks == 0; });
+  }
+  RegistryResult result{std::vector<uint64_t>((automata.size() + 63) / 64, 0), std::vector<uint64_t>((automata.size() + 63) / 64, 0), std::vector<unsigned>(automata.size(), 0)};
+  for (size_t i{0}; i < SUBSET.size(); ++i) {
+    result.transitions[SUBSET[i]] = transitionCounters[i];
+    std::vector<uint64_t>& bitmap{outcomes[i] == 2 ? result.failed : result.accepted};
+    if (outcomes[i] != 0) {
+      bitmap[SUBSET[i] / 64] |= uint64_t{1} << (SUBSET[i] % 64);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Interns a symbol into the shared table, if it is not interned yet.
+ * 
+ * @param SYMBOL Symbol to intern.
+ * @return The id of the symbol.
+ */
+uint8_t PDARegistry::Intern(const Symbol& SYMBOL) {
+  int16_t& id{symbolIds[static_cast<unsigned char>(SYMBOL.Value())]};
+  if (id < 0) {
+    id = static_cast<int16_t>(symbols.size());
+    symbols.emplace_back(SYMBOL);
+  }
+  return static_cast<uint8_t>(id);
+}
+
+/**
+ * @brief Searches breadth-first for a sequence of transitions of a PDA which consumes the input string and empties the stack.
+ * 
+ * @param AUTOMATON PDA to run.
+ * @param INPUT_IDS Input string, as interned symbols.
+ * @param failed Set to true if the maximum number of transitions is reached.
+ * @param transitionCounter Set to the number of transitions processed.
+ * @return true If the PDA accepts the input string.
+ * @return false If the PDA does not accept the input string.
+ */
+bool PDARegistry::Run(const Automaton& AUTOMATON, const std::string& INPUT_IDS, bool& failed, unsigned& transitionCounter) const {
+  const uint8_t EPSILON_ID{0};
+  // Configurations hold the state, the position of the next input symbol and the stack, with its top as last character.
+  std::queue<std::tuple<uint32_t, size_t, std::string>> pendantConfigurations;
+  pendantConfigurations.emplace(AUTOMATON.initialState, 0, std::string(1, static_cast<char>(AUTOMATON.initialStackSymbol)));
+  transitionCounter = 0;
+  while (!pendantConfigurations.empty()) {
+    ++transitionCounter;
+    auto [state, position, stack]{std::move(pendantConfigurations.front())};
+    pendantConfigurations.pop();
+    const bool IS_INPUT_CONSUMED{position == INPUT_IDS.size()};
+    if (stack.empty()) {
+      if (IS_INPUT_CONSUMED) {
+        return true;
+      }
+    } else {
+      const uint8_t STACK_TOP{static_cast<uint8_t>(stack.back())};
+      stack.pop_back();
+      const uint8_t ACTUAL_SYMBOL{IS_INPUT_CONSUMED ? EPSILON_ID : AUTOMATON.classOf[static_cast<uint8_t>(INPUT_IDS[position])]};
+      const auto PUSH_SUCCESSORS{[&](const TransitionKey* KEY, const size_t NEXT_POSITION) {
+        if (KEY == nullptr) {
+          return;
+        }
+        for (uint32_t i{KEY->begin}; i < KEY->end; ++i) {
+          const ArenaTransition& TRANSITION{transitions[i]};
+          std::string newStack{stack};
+          newStack.append(pushArena, TRANSITION.pushBegin, TRANSITION.pushLength);
+          pendantConfigurations.emplace(TRANSITION.toState, NEXT_POSITION, std::move(newStack));
+        }
+      }};
+      PUSH_SUCCESSORS(Find(AUTOMATON, state, ACTUAL_SYMBOL, STACK_TOP), IS_INPUT_CONSUMED ? position : position + 1);
+      if (ACTUAL_SYMBOL != EPSILON_ID) {
+        PUSH_SUCCESSORS(Find(AUTOMATON, state, EPSILON_ID, STACK_TOP), position);
+      }
+    }
+    if (transitionCounter == AUTOMATON.maxTransitions) {
+      failed = true;
+      return false;
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Finds the transitions of a PDA for a state, an input symbol and a stack top.
+ * 
+ * @param AUTOMATON PDA to look in.
+ * @param STATE State of the PDA.
+ * @param INPUT_SYMBOL Interned input symbol.
+ * @param STACK_TOP Interned stack top.
+ * @return The key with the range of transitions, or nullptr if there are none.
+ */
+const PDARegistry::TransitionKey* PDARegistry::Find(const Automaton& AUTOMATON, const uint32_t STATE, const uint8_t INPUT_SYMBOL, const uint8_t STACK_TOP) const {
+  const uint32_t KEY{PackKey(STATE, INPUT_SYMBOL, STACK_TOP)};
+  const auto END{keys.begin() + AUTOMATON.keysEnd};
+  const auto FOUND{std::lower_bound(keys.begin() + AUTOMATON.keysBegin, END, KEY, [](const TransitionKey& ENTRY, const uint32_t VALUE) { return ENTRY.key < VALUE; })};
+  return FOUND == END || FOUND->key != KEY ? nullptr : &*FOUND;
+}
+
+/**
+ * @brief Packs a state, an input symbol and a stack top into a key.
+ * 
+ * @param STATE State of the PDA.
+ * @param INPUT_SYMBOL Interned input symbol.
+ * @param STACK_TOP Interned stack top.
+ * @return The key.
+ */
+uint32_t PDARegistry::PackKey(const uint32_t STATE, const uint8_t INPUT_SYMBOL, const uint8_t STACK_TOP) {
+  return (STATE << 16) | (uint32_t{INPUT_SYMBOL} << 8) | STACK_TOP;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file PDARegistry.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to evaluate an input string against many PDAs at once.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <bitset>
+
+#include "../input/PDAInput.hpp"
+#include "../server/WorkerPool.hpp"
+
+/**
+ * @brief Type to represent the result of evaluating an input string against a registry. Bit i of each bitmap refers to the
+ *        PDA with index i in the registry: 'accepted' is set if it accepts the input string, and 'failed' is set if the
+ *        input string has symbols outside its alphabet (the empty symbol included) or the maximum number of transitions was
+ *        reached. Element i of
+ *        'transitions' is the number of transitions processed by that PDA.
+ */
+struct RegistryResult {
+  std::vector<uint64_t> accepted;
+  std::vector<uint64_t> failed;
+  std::vector<unsigned> transitions;
+
+  bool IsAccepted(size_t) const;
+  bool IsFailed(size_t) const;
+};
+
+/**
+ * @brief Class to evaluate an input string against many PDAs at once. The symbols of every PDA are interned into one shared
+ *        table, and all the transitions are stored in flat arenas:
+ * 
+ *        - Each PDA keeps a sorted slice of keys (state, input symbol, stack top) pointing to a range of transitions.
+ * 
+ *        - Each transition keeps its next state and a range of the arena of pushed symbols.
+ * 
+ *        The input string is converted into interned symbols once per call, and the PDAs run in parallel on a worker pool.
+ *        The search of each PDA follows the same breadth-first order as PDA::Accepts.
+ */
+class PDARegistry {
+  public:
+    PDARegistry(unsigned);
+    size_t Load(const std::string&, const std::string&);
+    size_t Add(const std::string&, const PDA&);
+    size_t Size() const;
+    size_t IndexOf(const std::string&) const;
+    const std::string& NameOf(size_t) const;
+    RegistryResult Evaluate(const std::string&) const;
+    RegistryResult Evaluate(const std::string&, const std::vector<size_t>&) const;
+  private:
+    /**
+     * @brief Transitions of a state for an input symbol and a stack top. The key packs the three of them.
+     */
+    struct TransitionKey {
+      uint32_t key;
+      uint32_t begin;
+      uint32_t end;
+    };
+
+    /**
+     * @brief Transition stored in the arena. The pushed symbols are stored bottom first, without empty symbols.
+     */
+    struct ArenaTransition {
+      uint32_t toState;
+      uint32_t pushBegin;
+      uint32_t pushLength;
+    };
+
+    /**
+     * @brief Data of a PDA of the registry.
+     */
+    struct Automaton {
+      std::string name;
+      uint32_t initialState;
+      uint8_t initialStackSymbol;
+      std::bitset<256> alphabet;
+      std::array<uint8_t, 256> classOf;
+      size_t keysBegin;
+      size_t keysEnd;
+      unsigned maxTransitions;
+    };
+
+    std::array<int16_t, 256> symbolIds;
+    std::vector<Symbol> symbols;
+    std::vector<Automaton> automata;
+    std::vector<TransitionKey> keys;
+    std::vector<ArenaTransition> transitions;
+    std::string pushArena;
+    std::map<std::string, size_t> indexes;
+    std::unique_ptr<WorkerPool> pool;
+    uint8_t Intern(const Symbol&);
+    bool Run(const Automaton&, const std::string&, bool&, unsigned&) const;
+    const TransitionKey* Find(const Automaton&, uint32_t, uint8_t, uint8_t) const;
+    static uint32_t PackKey(uint32_t, uint8_t, uint8_t);
+};
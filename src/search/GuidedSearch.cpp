@@ -0,0 +1,218 @@
+/**
+ * @file GuidedSearch.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to check the acceptance of a PDA with a best-first search guided by pop costs.
+ * @date 19/10/2026
+ */
+
+#include "GuidedSearch.hpp"
+
+/**
+ * @brief Cost of the symbols which can never be popped. It is low enough to add a few of them without overflowing.
+ */
+const uint64_t GuidedSearch::UNREACHABLE{uint64_t{1} << 40};
+
+/**
+ * @brief Type to represent a visited configuration: state, position of the next input symbol and stack.
+ */
+using VisitedConfiguration = std::tuple<const State*, size_t, PDAStack>;
+
+/**
+ * @brief Hash of a visited configuration.
+ */
+struct VisitedConfigurationHash {
+  size_t operator()(const VisitedConfiguration& CONFIGURATION) const {
+    size_t hash{std::hash<const State*>{}(std::get<0>(CONFIGURATION))};
+    hash ^= std::get<1>(CONFIGURATION) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    hash ^= std::get<2>(CONFIGURATION).Hash() + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+/**
+ * @brief Constructs a new GuidedSearch object, computing the pop costs of the PDA.
+ * 
+ * @param AUTOMATON PDA to check the acceptance of.
+ */
+GuidedSearch::GuidedSearch(const PDA& AUTOMATON) : automaton(AUTOMATON), transitionCounter(0) {
+  for (const auto& STATE : automaton.States()) {
+    stateIndexes.emplace(STATE.second, stateIndexes.size());
+  }
+  ComputePopCosts();
+}
+
+/**
+ * @brief Checks if the PDA accepts a given input string.
+ * 
+ * @param INPUT Input string to check.
+ * @return true If the PDA accepts the input string.
+ * @return false If the PDA does not accept the input string.
+ * @throw std::runtime_error If the maximum number of transitions is reached.
+ * @throw std::invalid_argument If a symbol of the input string is not in the PDA alphabet or is the empty symbol.
+ */
+bool GuidedSearch::Accepts(const std::string& INPUT) {
+  const std::vector<Symbol> INPUT_SYMBOLS{automaton.Classes().Translate(INPUT)};
+  transitionCounter = 0;
+  // Expanding first the configurations with the lowest estimated total of transitions, and then the most advanced ones.
+  const auto COMPARE{[](const std::pair<uint64_t, Configuration>& ONE, const std::pair<uint64_t, Configuration>& OTHER) {
+    return ONE.first != OTHER.first ? ONE.first > OTHER.first : ONE.second.position < OTHER.second.position;
+  }};
+  std::priority_queue<std::pair<uint64_t, Configuration>, std::vector<std::pair<uint64_t, Configuration>>, decltype(COMPARE)> frontier{COMPARE};
+  std::unordered_set<VisitedConfiguration, VisitedConfigurationHash> visited;
+  const auto ENQUEUE{[&](Configuration configuration) {
+    const PopCost REMAINING{RemainingCost(configuration)};
+    const uint64_t REMAINING_INPUT{INPUT_SYMBOLS.size() - configuration.position};
+    // Dropping the configurations which cannot empty their stack with the input symbols left.
+    if (REMAINING.inputSymbols > REMAINING_INPUT) {
+      return;
+    }
+    if (!visited.emplace(configuration.state, configuration.position, configuration.stack).second) {
+      return;
+    }
+    const uint64_t ESTIMATED_TRANSITIONS{configuration.processedTransitions + std::max(REMAINING.transitions, REMAINING_INPUT)};
+    frontier.emplace(ESTIMATED_TRANSITIONS, std::move(configuration));
+  }};
+  ENQUEUE(Configuration{automaton.InitialState(), 0, automaton.InitialStack(), 0, StackCost(std::vector<Symbol>{automaton.InitialStack().Top()})});
+  while (!frontier.empty()) {
+    ++transitionCounter;
+    Configuration current{frontier.top().second};
+    frontier.pop();
+    const bool IS_INPUT_CONSUMED{current.position == INPUT_SYMBOLS.size()};
+    if (current.stack.IsEmpty()) {
+      if (IS_INPUT_CONSUMED) {
+        return true;
+      }
+    } else {
+      const Symbol STACK_TOP{current.stack.Pop()};
+      const PopCost& TOP_COST{minimumPopCosts[static_cast<unsigned char>(STACK_TOP.Value())]};
+      const PopCost REST_COST{current.stackCost.inputSymbols - TOP_COST.inputSymbols, current.stackCost.transitions - TOP_COST.transitions};
+      const Symbol& ACTUAL_SYMBOL{IS_INPUT_CONSUMED ? Symbol::EPSILON : INPUT_SYMBOLS[current.position]};
+      const auto ENQUEUE_SUCCESSORS{[&](const Symbol& CONSUMED, const size_t NEXT_POSITION) {
+        for (const TransitionResult& TRANSITION : current.state->Transitions().GetTransitions(CONSUMED, STACK_TOP)) {
+          const std::vector<Symbol>& NEW_STACK_SYMBOLS{std::get<1>(TRANSITION)};
+          PDAStack newStack{current.stack};
+          newStack.Push(NEW_STACK_SYMBOLS);
+          const PopCost PUSHED_COST{StackCost(NEW_STACK_SYMBOLS)};
+          ENQUEUE(Configuration{std::get<0>(TRANSITION), NEXT_POSITION, newStack, current.processedTransitions + 1,
+                                PopCost{REST_COST.inputSymbols + PUSHED_COST.inputSymbols, REST_COST.transitions + PUSHED_COST.transitions}});
+        }
+      }};
+      ENQUEUE_SUCCESSORS(ACTUAL_SYMBOL, IS_INPUT_CONSUMED ? current.position : current.position + 1);
+      if (ACTUAL_SYMBOL != Symbol::EPSILON) {
+        ENQUEUE_SUCCESSORS(Symbol::EPSILON, current.position);
+      }
+    }
+    if (transitionCounter == automaton.MaxTransitions()) {
+      throw std::runtime_error{"Runtime error: Maximum number of transitions reached."};
+    }
+  }
+  return false;
+}
+
+/**
+ * @brief Returns the number of transitions processed by the last call to Accepts.
+ * 
+ * @return The number of transitions processed.
+ */
+unsigned GuidedSearch::TransitionCounter() const {
+  return transitionCounter;
+}
+
+/**
+ * @brief Computes the pop cost of every state and stack symbol as a fixed point. Popping X in state q with a transition that
+ *        pushes Y1...Yn and moves to state r costs that transition plus the cost of popping Y1 in r and the minimum cost,
+ *        over every state, of popping Y2...Yn. The costs only decrease on each iteration, so the computation ends.
+ */
+void GuidedSearch::ComputePopCosts() {
+  popCosts.assign(stateIndexes.size() * 256, PopCost{UNREACHABLE, UNREACHABLE});
+  minimumPopCosts.fill(PopCost{UNREACHABLE, UNREACHABLE});
+  bool changed{true};
+  while (changed) {
+    changed = false;
+    for (const auto& STATE : automaton.States()) {
+      for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+        for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+          for (const TransitionResult& RESULT : STACK_TRANSITIONS.second) {
+            PopCost cost{INPUT_TRANSITIONS.first == Symbol::EPSILON ? uint64_t{0} : uint64_t{1}, 1};
+            std::vector<Symbol> pushed;
+            std::copy_if(std::get<1>(RESULT).begin(), std::get<1>(RESULT).end(), std::back_inserter(pushed), [](const Symbol& SYMBOL) { return SYMBOL != Symbol::EPSILON; });
+            if (!pushed.empty()) {
+              const PopCost FIRST_COST{PopCostOf(std::get<0>(RESULT), pushed[0])};
+              const PopCost REST_COST{StackCost(std::vector<Symbol>{pushed.begin() + 1, pushed.end()})};
+              cost.inputSymbols = std::min(UNREACHABLE, cost.inputSymbols + FIRST_COST.inputSymbols + REST_COST.inputSymbols);
+              cost.transitions = std::min(UNREACHABLE, cost.transitions + FIRST_COST.transitions + REST_COST.transitions);
+            }
+            PopCost& stateCost{PopCostOf(STATE.second, STACK_TRANSITIONS.first)};
+            PopCost& minimumCost{minimumPopCosts[static_cast<unsigned char>(STACK_TRANSITIONS.first.Value())]};
+            if (cost.inputSymbols < stateCost.inputSymbols || cost.transitions < stateCost.transitions) {
+              stateCost = PopCost{std::min(cost.inputSymbols, stateCost.inputSymbols), std::min(cost.transitions, stateCost.transitions)};
+              minimumCost = PopCost{std::min(cost.inputSymbols, minimumCost.inputSymbols), std::min(cost.transitions, minimumCost.transitions)};
+              changed = true;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns a reference to the pop cost of a stack symbol in a state.
+ * 
+ * @param STATE State of the PDA.
+ * @param STACK_SYMBOL Stack symbol to pop.
+ * @return A reference to the pop cost.
+ */
+GuidedSearch::PopCost& GuidedSearch::PopCostOf(const State* STATE, const Symbol& STACK_SYMBOL) {
+  return popCosts[stateIndexes.at(STATE) * 256 + static_cast<unsigned char>(STACK_SYMBOL.Value())];
+}
+
+/**
+ * @brief Returns the pop cost of a stack symbol in a state.
+ * 
+ * @param STATE State of the PDA.
+ * @param STACK_SYMBOL Stack symbol to pop.
+ * @return The pop cost.
+ */
+GuidedSearch::PopCost GuidedSearch::PopCostOf(const State* STATE, const Symbol& STACK_SYMBOL) const {
+  return popCosts[stateIndexes.at(STATE) * 256 + static_cast<unsigned char>(STACK_SYMBOL.Value())];
+}
+
+/**
+ * @brief Returns the sum of the minimum pop costs of some stack symbols. Empty symbols cost nothing.
+ * 
+ * @param SYMBOLS Stack symbols.
+ * @return The sum of their minimum pop costs, capped at UNREACHABLE.
+ */
+GuidedSearch::PopCost GuidedSearch::StackCost(const std::vector<Symbol>& SYMBOLS) const {
+  PopCost cost{0, 0};
+  for (const Symbol& SYMBOL : SYMBOLS) {
+    if (SYMBOL != Symbol::EPSILON) {
+      const PopCost& SYMBOL_COST{minimumPopCosts[static_cast<unsigned char>(SYMBOL.Value())]};
+      cost.inputSymbols = std::min(UNREACHABLE, cost.inputSymbols + SYMBOL_COST.inputSymbols);
+      cost.transitions = std::min(UNREACHABLE, cost.transitions + SYMBOL_COST.transitions);
+    }
+  }
+  return cost;
+}
+
+/**
+ * @brief Returns a lower bound of the cost of emptying the stack of a configuration. The top symbol uses the pop cost of the
+ *        actual state, and the rest of the stack the minimum pop costs.
+ * 
+ * @param CONFIGURATION Configuration to estimate.
+ * @return The lower bound of the cost, or UNREACHABLE if the stack can never be emptied.
+ */
+GuidedSearch::PopCost GuidedSearch::RemainingCost(const Configuration& CONFIGURATION) const {
+  if (CONFIGURATION.stack.IsEmpty()) {
+    return PopCost{0, 0};
+  }
+  if (CONFIGURATION.stackCost.inputSymbols >= UNREACHABLE) {
+    return PopCost{UNREACHABLE, UNREACHABLE};
+  }
+  const Symbol STACK_TOP{CONFIGURATION.stack.Top()};
+  const PopCost& TOP_COST{minimumPopCosts[static_cast<unsigned char>(STACK_TOP.Value())]};
+  const PopCost STATE_TOP_COST{PopCostOf(CONFIGURATION.state, STACK_TOP)};
+  return PopCost{CONFIGURATION.stackCost.inputSymbols - TOP_COST.inputSymbols + STATE_TOP_COST.inputSymbols,
+                 CONFIGURATION.stackCost.transitions - TOP_COST.transitions + STATE_TOP_COST.transitions};
+}
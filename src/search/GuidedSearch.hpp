@@ -0,0 +1,67 @@
+/**
+ * @file GuidedSearch.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to check the acceptance of a PDA with a best-first search guided by pop costs.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <iterator>
+#include <tuple>
+#include <unordered_set>
+
+#include "../structure/PDA.hpp"
+
+/**
+ * @brief Class to check if a PDA accepts an input string with a best-first search instead of the breadth-first search of
+ *        PDA::Accepts. When it is constructed, it computes for each state and stack symbol a lower bound of the input symbols
+ *        and the transitions needed to pop that symbol. Then:
+ * 
+ *        - The frontier is ordered by the transitions processed plus a lower bound of the transitions left to empty the stack
+ *          and consume the input string.
+ * 
+ *        - Configurations which need more input symbols to empty their stack than the ones left are dropped, as well as
+ *          configurations already visited.
+ * 
+ *        The PDA must outlive the search, and must not be optimized again after the search is constructed.
+ */
+class GuidedSearch {
+  public:
+    const static uint64_t UNREACHABLE;
+
+    GuidedSearch(const PDA&);
+    bool Accepts(const std::string&);
+    unsigned TransitionCounter() const;
+  private:
+    /**
+     * @brief Lower bounds of the cost of popping a stack symbol: input symbols consumed and transitions processed.
+     */
+    struct PopCost {
+      uint64_t inputSymbols;
+      uint64_t transitions;
+    };
+
+    /**
+     * @brief Configuration of the PDA in the frontier. The sums hold the minimum pop cost, over every state, of all the
+     *        symbols in the stack, so they can be updated on each push and pop instead of walking the stack.
+     */
+    struct Configuration {
+      State* state;
+      size_t position;
+      PDAStack stack;
+      uint64_t processedTransitions;
+      PopCost stackCost;
+    };
+
+    const PDA& automaton;
+    std::map<const State*, size_t> stateIndexes;
+    std::vector<PopCost> popCosts;
+    std::array<PopCost, 256> minimumPopCosts;
+    unsigned transitionCounter;
+    void ComputePopCosts();
+    PopCost& PopCostOf(const State*, const Symbol&);
+    PopCost PopCostOf(const State*, const Symbol&) const;
+    PopCost StackCost(const std::vector<Symbol>&) const;
+    PopCost RemainingCost(const Configuration&) const;
+};
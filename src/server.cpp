@@ -0,0 +1,65 @@
+/**
+ * @file server.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the client code to run the PDA server.
+ * @date 19/10/2026
+ */
+
+#include <csignal>
+
+#include "server/PDAServer.hpp"
+
+/**
+ * @brief Main function which loads the given PDAs and serves acceptance requests on a Unix domain socket, or on the standard
+ *        input and output if the socket path is '-'.
+ * @return 0 on success, 1 on failure.
+ */
+int main(const int ARGC, const char* ARGV[]) {
+  const std::string USAGE{"Usage: " + std::string{ARGV[0]} + " [--workers <Workers>] [--cache <CacheBytes>] <SocketPath|-> <Name>=<PDAFileName>..."};
+  unsigned workers{std::max(1u, std::thread::hardware_concurrency())};
+  size_t cacheMemory{0};
+  int argument{1};
+  try {
+    for (; argument + 1 < ARGC && ARGV[argument][0] == '-' && ARGV[argument][1] == '-'; argument += 2) {
+      const std::string OPTION{ARGV[argument]};
+      if (OPTION == "--workers") {
+        workers = std::max(1ul, std::stoul(ARGV[argument + 1]));
+      } else if (OPTION == "--cache") {
+        cacheMemory = std::stoul(ARGV[argument + 1]);
+      } else {
+        throw std::invalid_argument{"Unknown option '" + OPTION + "'"};
+      }
+    }
+  } catch (const std::exception&) {
+    std::cerr << USAGE << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (ARGC - argument < 2) {
+    std::cerr << USAGE << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string SOCKET_PATH{ARGV[argument]};
+  std::map<std::string, std::string> automataFiles;
+  for (int i{argument + 1}; i < ARGC; ++i) {
+    const std::string AUTOMATON{ARGV[i]};
+    const size_t SEPARATOR{AUTOMATON.find('=')};
+    if (SEPARATOR == std::string::npos || SEPARATOR == 0) {
+      std::cerr << USAGE << std::endl;
+      return EXIT_FAILURE;
+    }
+    automataFiles.emplace(AUTOMATON.substr(0, SEPARATOR), AUTOMATON.substr(SEPARATOR + 1));
+  }
+  try {
+    // Writing to a closed connection must fail instead of ending the process.
+    std::signal(SIGPIPE, SIG_IGN);
+    PDAServer server{automataFiles, workers, cacheMemory};
+    if (SOCKET_PATH == "-") {
+      server.ServeStream(STDIN_FILENO, STDOUT_FILENO);
+    } else {
+      server.ServeSocket(SOCKET_PATH);
+    }
+  } catch (const std::exception& EXCEPTION) {
+    std::cerr << EXCEPTION.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
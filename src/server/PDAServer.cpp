@@ -0,0 +1,255 @@
+/**
+ * @file PDAServer.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to serve acceptance requests for preloaded PDAs.
+ * @date 19/10/2026
+ */
+
+#include "PDAServer.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * @brief Maximum length of a frame payload. Longer frames close the connection.
+ */
+const uint32_t PDAServer::MAX_FRAME_SIZE{1 << 20};
+
+/**
+ * @brief Maximum number of requests of a connection waiting for their response. Reading stops until one is written.
+ */
+const size_t PDAServer::MAX_PENDANT_RESPONSES{64};
+
+/**
+ * @brief Constructs a new PDAServer object, loading and optimizing one copy of every PDA per worker.
+ * 
+ * @param AUTOMATA_FILES Map from the name of each PDA to the file it is read from.
+ * @param WORKERS Number of worker threads.
+ * @param CACHE_MEMORY Maximum number of bytes of the result cache shared by the workers, or 0 to disable it.
+ * @throw std::invalid_argument If a file does not exist or the PDA specified in it is invalid.
+ */
+PDAServer::PDAServer(const std::map<std::string, std::string>& AUTOMATA_FILES, const unsigned WORKERS, const size_t CACHE_MEMORY)
+                     : workerAutomata(WORKERS), requests(0), accepted(0), rejected(0), errors(0), transitions(0), pool(WORKERS) {
+  if (CACHE_MEMORY > 0) {
+    cache = std::make_shared<ResultCache>(CACHE_MEMORY);
+  }
+  for (auto& automata : workerAutomata) {
+    for (const auto& AUTOMATON_FILE : AUTOMATA_FILES) {
+      std::unique_ptr<PDA> pda{new PDA{PDAInput::ReadPDA(AUTOMATON_FILE.second)}};
+      const std::string REPORT{pda->Optimize()};
+      if (&automata == &workerAutomata.front()) {
+        std::cerr << "PDA '" << AUTOMATON_FILE.first << "' loaded from file " << AUTOMATON_FILE.second << "\n" << REPORT << "\n";
+      }
+      pda->SetCache(cache);
+      automata.emplace(AUTOMATON_FILE.first, std::move(pda));
+    }
+  }
+}
+
+/**
+ * @brief Listens on a Unix domain socket, serving every connection on its own thread. It never returns.
+ * 
+ * @param SOCKET_PATH Path of the socket. A previous file in that path is removed.
+ * @throw std::runtime_error If the socket cannot be created.
+ */
+void PDAServer::ServeSocket(const std::string& SOCKET_PATH) {
+  sockaddr_un address{};
+  if (SOCKET_PATH.size() >= sizeof(address.sun_path)) {
+    throw std::runtime_error{"Server error: Socket path '" + SOCKET_PATH + "' is too long"};
+  }
+  address.sun_family = AF_UNIX;
+  std::strncpy(address.sun_path, SOCKET_PATH.c_str(), sizeof(address.sun_path) - 1);
+  const int SERVER_FD{socket(AF_UNIX, SOCK_STREAM, 0)};
+  if (SERVER_FD < 0) {
+    throw std::runtime_error{"Server error: Socket could not be created (" + std::string{std::strerror(errno)} + ")"};
+  }
+  unlink(SOCKET_PATH.c_str());
+  if (bind(SERVER_FD, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 || listen(SERVER_FD, SOMAXCONN) < 0) {
+    const std::string ERROR{std::strerror(errno)};
+    close(SERVER_FD);
+    throw std::runtime_error{"Server error: Socket '" + SOCKET_PATH + "' could not be listened on (" + ERROR + ")"};
+  }
+  std::cerr << "Listening on socket " << SOCKET_PATH << " with " << pool.Size() << " workers\n";
+  while (true) {
+    const int CLIENT_FD{accept(SERVER_FD, nullptr, nullptr)};
+    if (CLIENT_FD < 0) {
+      continue;
+    }
+    std::thread{[this, CLIENT_FD]() {
+      ServeStream(CLIENT_FD, CLIENT_FD);
+      close(CLIENT_FD);
+    }}.detach();
+  }
+}
+
+/**
+ * @brief Serves the requests read from a file descriptor until it is closed, writing the responses in order to another one.
+ *        At most MAX_PENDANT_RESPONSES requests are in flight, so a client pipelining requests cannot grow the memory of the
+ *        server without bound.
+ * 
+ * @param INPUT_FD File descriptor to read the requests from.
+ * @param OUTPUT_FD File descriptor to write the responses to.
+ */
+void PDAServer::ServeStream(const int INPUT_FD, const int OUTPUT_FD) {
+  std::queue<std::future<std::string>> pendantResponses;
+  std::mutex mutex;
+  std::condition_variable responseQueued;
+  std::condition_variable responseTaken;
+  bool isInputClosed{false};
+  // Writing the responses in the order of the requests, while the next requests are still being read and evaluated.
+  std::thread writer{[&]() {
+    bool isOutputOpen{true};
+    while (true) {
+      std::future<std::string> response;
+      {
+        std::unique_lock<std::mutex> lock{mutex};
+        responseQueued.wait(lock, [&]() { return isInputClosed || !pendantResponses.empty(); });
+        if (pendantResponses.empty()) {
+          return;
+        }
+        response = std::move(pendantResponses.front());
+        pendantResponses.pop();
+      }
+      responseTaken.notify_one();
+      // Waiting for every response even if the client is gone, so no job outlives this connection.
+      const std::string PAYLOAD{response.get()};
+      isOutputOpen = isOutputOpen && WriteFrame(OUTPUT_FD, PAYLOAD);
+    }
+  }};
+  for (std::string payload; ReadFrame(INPUT_FD, payload);) {
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      responseTaken.wait(lock, [&]() { return pendantResponses.size() < MAX_PENDANT_RESPONSES; });
+    }
+    std::future<std::string> response;
+    if (payload == "STATS") {
+      // Deferred until the writer reaches it, so it includes every previous request of the connection. Later requests already
+      // evaluated by the workers are included too.
+      response = std::async(std::launch::deferred, [this]() { return Stats(); });
+    } else {
+      const auto PROMISE{std::make_shared<std::promise<std::string>>()};
+      response = PROMISE->get_future();
+      pool.Submit([this, PROMISE, payload](const unsigned WORKER) { PROMISE->set_value(Evaluate(WORKER, payload)); });
+    }
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      pendantResponses.push(std::move(response));
+    }
+    responseQueued.notify_one();
+  }
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    isInputClosed = true;
+  }
+  responseQueued.notify_one();
+  writer.join();
+}
+
+/**
+ * @brief Evaluates an acceptance request with the PDAs of a worker.
+ * 
+ * @param WORKER Number of the worker evaluating the request.
+ * @param PAYLOAD Request, with the name of the PDA and the input string separated by a space.
+ * @return The response to the request.
+ */
+std::string PDAServer::Evaluate(const unsigned WORKER, const std::string& PAYLOAD) {
+  ++requests;
+  const size_t SEPARATOR{PAYLOAD.find(' ')};
+  const std::string NAME{PAYLOAD.substr(0, SEPARATOR)};
+  const std::string INPUT{SEPARATOR == std::string::npos ? std::string{} : PAYLOAD.substr(SEPARATOR + 1)};
+  const auto AUTOMATON{workerAutomata[WORKER].find(NAME)};
+  if (AUTOMATON == workerAutomata[WORKER].end()) {
+    ++errors;
+    return "ERROR Request error: PDA '" + NAME + "' not loaded";
+  }
+  try {
+    const auto START{std::chrono::steady_clock::now()};
+    const bool IS_ACCEPTED{AUTOMATON->second->Accepts(INPUT)};
+    const auto ELAPSED{std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START)};
+    const unsigned TRANSITIONS{AUTOMATON->second->TransitionCounter()};
+    transitions += TRANSITIONS;
+    ++(IS_ACCEPTED ? accepted : rejected);
+    return (IS_ACCEPTED ? "ACCEPTED " : "REJECTED ") + std::to_string(TRANSITIONS) + " " + std::to_string(ELAPSED.count());
+  } catch (const std::exception& EXCEPTION) {
+    ++errors;
+    return "ERROR " + std::string{EXCEPTION.what()};
+  }
+}
+
+/**
+ * @brief Returns the statistics of the server since it started.
+ * 
+ * @return The statistics of the server.
+ */
+std::string PDAServer::Stats() const {
+  std::stringstream stats;
+  stats << "STATS requests=" << requests << " accepted=" << accepted << " rejected=" << rejected << " errors=" << errors;
+  stats << " transitions=" << transitions << " cacheHitRate=" << (cache != nullptr ? cache->HitRate() : 0.0);
+  return stats.str();
+}
+
+/**
+ * @brief Reads a frame from a file descriptor.
+ * 
+ * @param FD File descriptor to read from.
+ * @param payload Set to the payload of the frame.
+ * @return true If a frame is read.
+ * @return false If the file descriptor is closed, fails or the frame is longer than MAX_FRAME_SIZE.
+ */
+bool PDAServer::ReadFrame(const int FD, std::string& payload) {
+  const auto READ_FULLY{[FD](char* buffer, size_t size) {
+    while (size > 0) {
+      const ssize_t READ{read(FD, buffer, size)};
+      if (READ < 0 && errno == EINTR) {
+        continue;
+      }
+      if (READ <= 0) {
+        return false;
+      }
+      buffer += READ;
+      size -= static_cast<size_t>(READ);
+    }
+    return true;
+  }};
+  unsigned char header[4];
+  if (!READ_FULLY(reinterpret_cast<char*>(header), sizeof(header))) {
+    return false;
+  }
+  const uint32_t SIZE{(uint32_t{header[0]} << 24) | (uint32_t{header[1]} << 16) | (uint32_t{header[2]} << 8) | uint32_t{header[3]}};
+  if (SIZE > MAX_FRAME_SIZE) {
+    return false;
+  }
+  payload.assign(SIZE, '\0');
+  return READ_FULLY(&payload[0], SIZE);
+}
+
+/**
+ * @brief Writes a frame to a file descriptor.
+ * 
+ * @param FD File descriptor to write to.
+ * @param PAYLOAD Payload of the frame.
+ * @return true If the frame is written.
+ * @return false If the file descriptor is closed or fails.
+ */
+bool PDAServer::WriteFrame(const int FD, const std::string& PAYLOAD) {
+  const uint32_t SIZE{static_cast<uint32_t>(PAYLOAD.size())};
+  std::string frame{static_cast<char>(SIZE >> 24), static_cast<char>(SIZE >> 16), static_cast<char>(SIZE >> 8), static_cast<char>(SIZE)};
+  frame += PAYLOAD;
+  const char* buffer{frame.data()};
+  size_t size{frame.size()};
+  while (size > 0) {
+    const ssize_t WRITTEN{write(FD, buffer, size)};
+    if (WRITTEN < 0 && errno == EINTR) {
+      continue;
+    }
+    if (WRITTEN <= 0) {
+      return false;
+    }
+    buffer += WRITTEN;
+    size -= static_cast<size_t>(WRITTEN);
+  }
+  return true;
+}
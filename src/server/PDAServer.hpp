@@ -0,0 +1,57 @@
+/**
+ * @file PDAServer.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to serve acceptance requests for preloaded PDAs.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+#include "WorkerPool.hpp"
+#include "../input/PDAInput.hpp"
+
+/**
+ * @brief Class to serve acceptance requests for a set of named PDAs, loaded once at startup. Requests are read from a Unix
+ *        domain socket or from a pair of file descriptors, and can be pipelined: they are evaluated in parallel on a worker
+ *        pool, and the responses are written in the same order as the requests. Every message is a frame made of its length,
+ *        as a 4 byte big-endian integer, followed by its payload:
+ * 
+ *        - Request "<automatonName> <input>": response "ACCEPTED <transitions> <microseconds>",
+ *          "REJECTED <transitions> <microseconds>" or "ERROR <message>".
+ * 
+ *        - Request "STATS": response "STATS requests=<n> accepted=<n> rejected=<n> errors=<n> transitions=<n> cacheHitRate=<rate>".
+ *          It counts every request evaluated before its response is written, which includes the previous requests of the
+ *          connection and may include later ones.
+ * 
+ *        Each connection has at most MAX_PENDANT_RESPONSES requests waiting for their response.
+ * 
+ *        Each worker owns its own copy of every PDA, as a PDA is not safe to share between threads, while the result cache
+ *        is shared by all of them.
+ */
+class PDAServer {
+  public:
+    const static uint32_t MAX_FRAME_SIZE;
+    const static size_t MAX_PENDANT_RESPONSES;
+
+    PDAServer(const std::map<std::string, std::string>&, unsigned, size_t);
+    void ServeSocket(const std::string&);
+    void ServeStream(int, int);
+  private:
+    std::vector<std::map<std::string, std::unique_ptr<PDA>>> workerAutomata;
+    std::shared_ptr<ResultCache> cache;
+    std::atomic<size_t> requests;
+    std::atomic<size_t> accepted;
+    std::atomic<size_t> rejected;
+    std::atomic<size_t> errors;
+    std::atomic<size_t> transitions;
+    // Declared last, so the workers are stopped before the PDAs they use are destroyed.
+    WorkerPool pool;
+    std::string Evaluate(unsigned, const std::string&);
+    std::string Stats() const;
+    static bool ReadFrame(int, std::string&);
+    static bool WriteFrame(int, const std::string&);
+};
@@ -0,0 +1,76 @@
+/**
+ * @file WorkerPool.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run jobs on a fixed set of worker threads.
+ * @date 19/10/2026
+ */
+
+#include "WorkerPool.hpp"
+
+/**
+ * @brief Constructs a new WorkerPool object, starting its worker threads.
+ * 
+ * @param WORKERS Number of worker threads.
+ */
+WorkerPool::WorkerPool(const unsigned WORKERS) : isStopping(false) {
+  for (unsigned i{0}; i < WORKERS; ++i) {
+    workers.emplace_back(&WorkerPool::Work, this, i);
+  }
+}
+
+/**
+ * @brief Queues a job to be run by the first free worker.
+ * 
+ * @param JOB Job to run.
+ */
+void WorkerPool::Submit(const Job& JOB) {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    pendantJobs.push(JOB);
+  }
+  jobAvailable.notify_one();
+}
+
+/**
+ * @brief Returns the number of worker threads.
+ * 
+ * @return The number of worker threads.
+ */
+unsigned WorkerPool::Size() const {
+  return static_cast<unsigned>(workers.size());
+}
+
+/**
+ * @brief Destroys the WorkerPool object, running the pendant jobs and waiting for the worker threads to finish.
+ */
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    isStopping = true;
+  }
+  jobAvailable.notify_all();
+  for (std::thread& worker : workers) {
+    worker.join();
+  }
+}
+
+/**
+ * @brief Runs the jobs of the queue until the pool is stopped and the queue is empty.
+ * 
+ * @param WORKER Number of the worker.
+ */
+void WorkerPool::Work(const unsigned WORKER) {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock{mutex};
+      jobAvailable.wait(lock, [this]() { return isStopping || !pendantJobs.empty(); });
+      if (pendantJobs.empty()) {
+        return;
+      }
+      job = std::move(pendantJobs.front());
+      pendantJobs.pop();
+    }
+    job(WORKER);
+  }
+}
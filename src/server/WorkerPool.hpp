@@ -0,0 +1,41 @@
+/**
+ * @file WorkerPool.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run jobs on a fixed set of worker threads.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Class to run jobs on a fixed set of worker threads. Each job receives the number of the worker running it, so
+ *        workers can own data which is not safe to share, like the PDAs evaluating the inputs.
+ */
+class WorkerPool {
+  public:
+    /**
+     * @brief Type to represent a job. It receives the number of the worker running it.
+     */
+    using Job = std::function<void(unsigned)>;
+
+    WorkerPool(unsigned);
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    void Submit(const Job&);
+    unsigned Size() const;
+    ~WorkerPool();
+  private:
+    std::vector<std::thread> workers;
+    std::queue<Job> pendantJobs;
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    bool isStopping;
+    void Work(unsigned);
+};
@@ -0,0 +1,83 @@
+/**
+ * @file stress.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the client code to compare every acceptance engine on random PDAs and input strings.
+ * @date 19/10/2026
+ */
+
+#include "stress/StressHarness.hpp"
+
+/**
+ * @brief Main function which runs the stress harness with the given options and prints the statistics of every engine.
+ * @return 0 if every engine agrees with the reference, 1 otherwise.
+ */
+int main(const int ARGC, const char* ARGV[]) {
+  const std::string USAGE{"Usage: " + std::string{ARGV[0]} + " [--seed <Seed>] [--cases <Cases>] [--states <States>] [--input-symbols <Symbols>]"
+                          " [--stack-symbols <Symbols>] [--density <Probability>] [--epsilon-density <Probability>] [--nondeterminism <Transitions>]"
+                          " [--max-pushed <Symbols>] [--inputs <Inputs>] [--empty-symbol-density <Probability>] [--max-length <Length>] [--max-transitions <Transitions>]"
+                          " [--generated] [--output <Directory>] [--csv <CsvFileName>]"};
+  StressOptions options;
+  try {
+    for (int argument{1}; argument < ARGC; ++argument) {
+      const std::string OPTION{ARGV[argument]};
+      if (OPTION == "--generated") {
+        options.generated = true;
+        continue;
+      }
+      if (argument + 1 == ARGC) {
+        throw std::invalid_argument{"Missing value of option '" + OPTION + "'"};
+      }
+      const std::string VALUE{ARGV[++argument]};
+      if (OPTION == "--seed") {
+        options.seed = std::stoul(VALUE);
+      } else if (OPTION == "--cases") {
+        options.cases = std::stoul(VALUE);
+      } else if (OPTION == "--states") {
+        options.states = std::stoul(VALUE);
+      } else if (OPTION == "--input-symbols") {
+        options.inputSymbols = std::stoul(VALUE);
+      } else if (OPTION == "--stack-symbols") {
+        options.stackSymbols = std::stoul(VALUE);
+      } else if (OPTION == "--density") {
+        options.density = std::stod(VALUE);
+      } else if (OPTION == "--epsilon-density") {
+        options.epsilonDensity = std::stod(VALUE);
+      } else if (OPTION == "--nondeterminism") {
+        options.nondeterminism = std::stoul(VALUE);
+      } else if (OPTION == "--max-pushed") {
+        options.maxPushed = std::stoul(VALUE);
+      } else if (OPTION == "--inputs") {
+        options.inputs = std::stoul(VALUE);
+      } else if (OPTION == "--empty-symbol-density") {
+        options.emptySymbolDensity = std::stod(VALUE);
+      } else if (OPTION == "--max-length") {
+        options.maxInputLength = std::stoul(VALUE);
+      } else if (OPTION == "--max-transitions") {
+        options.maxTransitions = std::stoul(VALUE);
+      } else if (OPTION == "--output") {
+        options.outputDirectory = VALUE;
+      } else if (OPTION == "--csv") {
+        options.csvFileName = VALUE;
+      } else {
+        throw std::invalid_argument{"Unknown option '" + OPTION + "'"};
+      }
+    }
+  } catch (const std::exception&) {
+    std::cerr << USAGE << std::endl;
+    return EXIT_FAILURE;
+  }
+  try {
+    std::cout << "Running " << options.cases << " random PDAs with " << options.inputs << " input strings each (seed " << options.seed << ")...\n";
+    StressHarness harness{options};
+    const uint64_t DISAGREEMENTS{harness.Run(std::cout)};
+    harness.WriteReport(std::cout);
+    if (!options.csvFileName.empty()) {
+      harness.AppendCsv();
+    }
+    std::cout << "--> " << DISAGREEMENTS << " disagreements found" << std::endl;
+    return DISAGREEMENTS == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception& EXCEPTION) {
+    std::cerr << EXCEPTION.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,187 @@
+/**
+ * @file StressCase.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to represent and generate the random PDAs of the stress harness.
+ * @date 19/10/2026
+ */
+
+#include "StressCase.hpp"
+
+/**
+ * @brief Constructs a new StressCase object.
+ * 
+ * @param STATES Number of states of the PDA.
+ * @param INPUT_ALPHABET Input symbols of the PDA.
+ * @param STACK_ALPHABET Stack symbols of the PDA. The first one is the initial stack symbol.
+ * @param TRANSITIONS Transitions of the PDA.
+ */
+StressCase::StressCase(const unsigned STATES, const std::string& INPUT_ALPHABET, const std::string& STACK_ALPHABET, const std::vector<StressTransition>& TRANSITIONS)
+                       : states(STATES), inputAlphabet(INPUT_ALPHABET), stackAlphabet(STACK_ALPHABET), transitions(TRANSITIONS) {}
+
+/**
+ * @brief Generates a random PDA. Each state has transitions for an input symbol and a stack top with probability 'density',
+ *        and empty transitions for a stack top with probability 'epsilonDensity'. Each of them gets between 1 and
+ *        'nondeterminism' transitions to random states, pushing up to 'maxPushed' random stack symbols.
+ * 
+ * @param OPTIONS Parameters of the PDA.
+ * @param random Random number generator.
+ * @return The random PDA.
+ */
+StressCase StressCase::Generate(const StressOptions& OPTIONS, std::mt19937& random) {
+  const unsigned STATES{std::max(1u, OPTIONS.states)};
+  const std::string INPUT_ALPHABET{std::string{"abcdefghijklmnopqrstuvwxyz"}.substr(0, std::clamp(OPTIONS.inputSymbols, 1u, 26u))};
+  const std::string STACK_ALPHABET{std::string{"ABCDEFGHIJKLMNOPQRSTUVWXYZ"}.substr(0, std::clamp(OPTIONS.stackSymbols, 1u, 26u))};
+  std::bernoulli_distribution hasTransitions{OPTIONS.density};
+  std::bernoulli_distribution hasEmptyTransitions{OPTIONS.epsilonDensity};
+  std::uniform_int_distribution<unsigned> transitionsCount{1, std::max(1u, OPTIONS.nondeterminism)};
+  std::uniform_int_distribution<unsigned> stateChoice{0, STATES - 1};
+  std::uniform_int_distribution<unsigned> pushedLength{0, OPTIONS.maxPushed};
+  std::uniform_int_distribution<size_t> stackSymbolChoice{0, STACK_ALPHABET.size() - 1};
+  std::vector<StressTransition> transitions;
+  for (unsigned state{0}; state < STATES; ++state) {
+    for (const char STACK_TOP : STACK_ALPHABET) {
+      for (const char INPUT_SYMBOL : INPUT_ALPHABET + Symbol::EPSILON.ToString()) {
+        if (!(INPUT_SYMBOL == Symbol::EPSILON.Value() ? hasEmptyTransitions(random) : hasTransitions(random))) {
+          continue;
+        }
+        for (unsigned i{transitionsCount(random)}; i > 0; --i) {
+          const unsigned TO_STATE{stateChoice(random)};
+          std::string pushed;
+          for (unsigned j{pushedLength(random)}; j > 0; --j) {
+            pushed += STACK_ALPHABET[stackSymbolChoice(random)];
+          }
+          transitions.emplace_back(StressTransition{state, INPUT_SYMBOL, STACK_TOP, TO_STATE, pushed});
+        }
+      }
+    }
+  }
+  return StressCase{STATES, INPUT_ALPHABET, STACK_ALPHABET, transitions};
+}
+
+/**
+ * @brief Generates a random input string over the input alphabet, with up to 'maxInputLength' symbols.
+ * 
+ * @param OPTIONS Parameters of the input string.
+ * @param random Random number generator.
+ * @return The random input string.
+ */
+std::string StressCase::RandomInput(const StressOptions& OPTIONS, std::mt19937& random) const {
+  std::uniform_int_distribution<unsigned> length{0, OPTIONS.maxInputLength};
+  std::uniform_int_distribution<size_t> symbolChoice{0, inputAlphabet.size() - 1};
+  std::string input;
+  for (unsigned i{length(random)}; i > 0; --i) {
+    input += inputAlphabet[symbolChoice(random)];
+  }
+  return input;
+}
+
+/**
+ * @brief Generates an input string by following random transitions of the PDA until its stack is empty, so most of them
+ *        are accepted. When it follows an epsilon transition, it writes the empty symbol with 'emptySymbolDensity'
+ *        probability, so the input string is invalid. If the walk gets stuck, a random input string is generated instead.
+ * 
+ * @param OPTIONS Parameters of the input string.
+ * @param random Random number generator.
+ * @return The input string consumed by the walk.
+ */
+std::string StressCase::WalkInput(const StressOptions& OPTIONS, std::mt19937& random) const {
+  // The top of the stack is its last character.
+  std::string stack(1, stackAlphabet[0]);
+  unsigned state{0};
+  std::string consumed;
+  for (unsigned step{0}; step < 4 * (OPTIONS.maxInputLength + 1) && !stack.empty(); ++step) {
+    std::vector<const StressTransition*> applicable;
+    for (const StressTransition& TRANSITION : transitions) {
+      if (TRANSITION.fromState == state && TRANSITION.stackTop == stack.back() &&
+          (TRANSITION.inputSymbol == Symbol::EPSILON.Value() || consumed.size() < OPTIONS.maxInputLength)) {
+        applicable.emplace_back(&TRANSITION);
+      }
+    }
+    if (applicable.empty()) {
+      break;
+    }
+    const StressTransition& TRANSITION{*applicable[std::uniform_int_distribution<size_t>{0, applicable.size() - 1}(random)]};
+    stack.pop_back();
+    stack.append(TRANSITION.pushed.rbegin(), TRANSITION.pushed.rend());
+    state = TRANSITION.toState;
+    if (TRANSITION.inputSymbol != Symbol::EPSILON.Value()) {
+      consumed += TRANSITION.inputSymbol;
+    } else if (std::bernoulli_distribution{OPTIONS.emptySymbolDensity}(random)) {
+      // The empty symbol cannot appear in input strings, so every engine must report the input string as invalid.
+      consumed += Symbol::EPSILON.Value();
+    }
+  }
+  return stack.empty() ? consumed : RandomInput(OPTIONS, random);
+}
+
+/**
+ * @brief Builds the PDA by reading its text, as it would be read from a file.
+ * 
+ * @return The PDA.
+ */
+std::unique_ptr<PDA> StressCase::Build() const {
+  std::stringstream reader{ToString()};
+  return std::unique_ptr<PDA>{new PDA{PDAInput::ReadPDA(reader)}};
+}
+
+/**
+ * @brief Writes the PDA in the format read by PDAInput.
+ * 
+ * @return The text of the PDA.
+ */
+std::string StressCase::ToString() const {
+  std::stringstream text;
+  for (unsigned state{0}; state < states; ++state) {
+    text << (state == 0 ? "" : " ") << "q" << state;
+  }
+  text << "\n";
+  for (size_t i{0}; i < inputAlphabet.size(); ++i) {
+    text << (i == 0 ? "" : " ") << inputAlphabet[i];
+  }
+  text << "\n";
+  for (size_t i{0}; i < stackAlphabet.size(); ++i) {
+    text << (i == 0 ? "" : " ") << stackAlphabet[i];
+  }
+  text << "\nq0\n" << stackAlphabet[0] << "\n";
+  for (const StressTransition& TRANSITION : transitions) {
+    text << "q" << TRANSITION.fromState << " " << TRANSITION.inputSymbol << " " << TRANSITION.stackTop << " q" << TRANSITION.toState << " "
+         << (TRANSITION.pushed.empty() ? Symbol::EPSILON.ToString() : TRANSITION.pushed) << "\n";
+  }
+  return text.str();
+}
+
+/**
+ * @brief Returns the number of states of the PDA.
+ * 
+ * @return The number of states.
+ */
+unsigned StressCase::States() const {
+  return states;
+}
+
+/**
+ * @brief Returns the input symbols of the PDA.
+ * 
+ * @return The input symbols.
+ */
+const std::string& StressCase::InputAlphabet() const {
+  return inputAlphabet;
+}
+
+/**
+ * @brief Returns the stack symbols of the PDA. The first one is the initial stack symbol.
+ * 
+ * @return The stack symbols.
+ */
+const std::string& StressCase::StackAlphabet() const {
+  return stackAlphabet;
+}
+
+/**
+ * @brief Returns the transitions of the PDA.
+ * 
+ * @return The transitions.
+ */
+const std::vector<StressTransition>& StressCase::Transitions() const {
+  return transitions;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file StressCase.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to represent and generate the random PDAs of the stress harness.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <random>
+
+#include "../input/PDAInput.hpp"
+
+/**
+ * @brief Parameters of the random PDAs and input strings generated by the stress harness.
+ */
+struct StressOptions {
+  unsigned seed{1};
+  unsigned cases{200};
+  unsigned states{3};
+  unsigned inputSymbols{2};
+  unsigned stackSymbols{2};
+  // Probability that a state has transitions for an input symbol and a stack top.
+  double density{0.5};
+  // Probability that a state has empty transitions for a stack top.
+  double epsilonDensity{0.2};
+  // Maximum number of transitions of a state for the same input symbol and stack top.
+  unsigned nondeterminism{2};
+  unsigned maxPushed{2};
+  unsigned inputs{20};
+  // Probability that a walk writes the empty symbol in its input string when it follows an epsilon transition.
+  double emptySymbolDensity{0.05};
+  unsigned maxInputLength{8};
+  unsigned maxTransitions{20000};
+  // Also compares the recognizer of PDACodeGenerator, compiled once per PDA.
+  bool generated{false};
+  std::string outputDirectory{"."};
+  std::string csvFileName;
+};
+
+/**
+ * @brief Transition of a random PDA. The pushed symbols are written with the new top first, and an empty string pushes
+ *        nothing.
+ */
+struct StressTransition {
+  unsigned fromState;
+  char inputSymbol;
+  char stackTop;
+  unsigned toState;
+  std::string pushed;
+};
+
+/**
+ * @brief Class to represent a random PDA of the stress harness. States are named q0, q1..., the input symbols are lowercase
+ *        letters and the stack symbols uppercase letters. The initial state is q0 and the initial stack symbol is the first
+ *        stack symbol. It can be written in the format read by PDAInput, so every engine loads it from the same text.
+ */
+class StressCase {
+  public:
+    StressCase(unsigned, const std::string&, const std::string&, const std::vector<StressTransition>&);
+    static StressCase Generate(const StressOptions&, std::mt19937&);
+    std::string RandomInput(const StressOptions&, std::mt19937&) const;
+    std::string WalkInput(const StressOptions&, std::mt19937&) const;
+    std::unique_ptr<PDA> Build() const;
+    std::string ToString() const;
+    unsigned States() const;
+    const std::string& InputAlphabet() const;
+    const std::string& StackAlphabet() const;
+    const std::vector<StressTransition>& Transitions() const;
+  private:
+    unsigned states;
+    std::string inputAlphabet;
+    std::string stackAlphabet;
+    std::vector<StressTransition> transitions;
+};
@@ -0,0 +1,207 @@
+/**
+ * @file StressEngines.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to run every acceptance engine on a PDA of the stress harness.
+ * @date 19/10/2026
+ */
+
+#include "StressEngines.hpp"
+
+/**
+ * @brief Names of the engines, in the order of their indexes.
+ */
+const std::vector<std::string> StressEngines::NAMES{"bfs", "optimized", "guided", "registry", "cached", "cache-hit", "generated"};
+
+/**
+ * @brief Index of the reference engine.
+ */
+const size_t StressEngines::REFERENCE{0};
+
+/**
+ * @brief Index of the generated recognizer engine. It is the last one, so it can be left out when disabled.
+ */
+const size_t StressEngines::GENERATED{6};
+
+/**
+ * @brief Number of recognizers compiled, so every one gets its own files.
+ */
+unsigned StressEngines::recognizerCounter{0};
+
+/**
+ * @brief Constructs a new StressEngines object, loading the PDA into every engine.
+ * 
+ * @param STRESS_CASE PDA to load.
+ * @param OPTIONS Options of the harness. The maximum number of transitions applies to each engine on each input string, and
+ *                the recognizer files are written in the output directory.
+ * @param CACHE Result cache of the cached engine.
+ */
+StressEngines::StressEngines(const StressCase& STRESS_CASE, const StressOptions& OPTIONS, const std::shared_ptr<ResultCache>& CACHE)
+                             : reference(STRESS_CASE.Build()), optimized(STRESS_CASE.Build()), cached(STRESS_CASE.Build()), registry(2),
+                               isGenerated(OPTIONS.generated), recognizerName(OPTIONS.outputDirectory + "/stress-recognizer-" + std::to_string(OPTIONS.seed)) {
+  reference->SetMaxTransitions(OPTIONS.maxTransitions);
+  optimized->SetMaxTransitions(OPTIONS.maxTransitions);
+  optimized->Optimize();
+  cached->SetMaxTransitions(OPTIONS.maxTransitions);
+  cached->SetCache(CACHE);
+  guided = std::make_unique<GuidedSearch>(*reference);
+  // Two PDAs, so the registry splits them between the threads of its pool.
+  registry.Add("stress", *reference);
+  registry.Add("stress-optimized", *optimized);
+}
+
+/**
+ * @brief Runs the generated recognizer on some input strings, compiling it first if needed, and keeps the results for Run.
+ *        Does nothing if the generated recognizer is disabled.
+ * 
+ * @param INPUTS Input strings to check.
+ * @throw std::runtime_error If the recognizer cannot be compiled or run.
+ */
+void StressEngines::Prepare(const std::vector<std::string>& INPUTS) {
+  if (!isGenerated || INPUTS.empty()) {
+    return;
+  }
+  if (recognizer == nullptr) {
+    recognizer = std::make_unique<GeneratedRecognizer>(*reference, recognizerName + "-" + std::to_string(recognizerCounter++));
+  }
+  const auto START{std::chrono::steady_clock::now()};
+  const std::vector<RecognizerResult> RESULTS{recognizer->Run(INPUTS)};
+  const uint64_t NANOSECONDS{static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START).count())};
+  for (size_t i{0}; i < INPUTS.size(); ++i) {
+    EngineOutcome outcome{EngineOutcome::LIMIT};
+    switch (RESULTS[i].outcome) {
+      case RecognizerOutcome::ACCEPTED:
+        outcome = EngineOutcome::ACCEPTED;
+        break;
+      case RecognizerOutcome::REJECTED:
+        outcome = EngineOutcome::REJECTED;
+        break;
+      case RecognizerOutcome::LIMIT:
+        break;
+      default:
+        outcome = EngineOutcome::INVALID;
+    }
+    generatedRuns[INPUTS[i]] = EngineRun{outcome, RESULTS[i].transitions, NANOSECONDS / INPUTS.size()};
+  }
+}
+
+/**
+ * @brief Runs an engine on an input string.
+ * 
+ * @param ENGINE Index of the engine.
+ * @param INPUT Input string to check.
+ * @return The outcome of the engine, the transitions it processed and the time it took. Input strings with symbols out of
+ *         the PDA alphabet give an invalid outcome.
+ * @throw std::invalid_argument If the engine does not exist or is disabled.
+ * @throw std::runtime_error If the generated recognizer cannot be compiled or run.
+ */
+EngineRun StressEngines::Run(const size_t ENGINE, const std::string& INPUT) {
+  const auto START{std::chrono::steady_clock::now()};
+  const auto ELAPSED{[&START]() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START).count());
+  }};
+  switch (ENGINE) {
+    case 0:
+      return RunPDA(*reference, INPUT);
+    case 1:
+      return RunPDA(*optimized, INPUT);
+    case 2: {
+      EngineOutcome outcome{EngineOutcome::LIMIT};
+      try {
+        outcome = guided->Accepts(INPUT) ? EngineOutcome::ACCEPTED : EngineOutcome::REJECTED;
+      } catch (const std::invalid_argument&) {
+        return EngineRun{EngineOutcome::INVALID, 0, ELAPSED()};
+      } catch (const std::runtime_error&) {}
+      return EngineRun{outcome, guided->TransitionCounter(), ELAPSED()};
+    }
+    case 3: {
+      const RegistryResult RESULT{registry.Evaluate(INPUT)};
+      // A failed PDA without transitions processed rejected the symbols of the input string.
+      const EngineOutcome FAILED_OUTCOME{RESULT.transitions[0] == 0 ? EngineOutcome::INVALID : EngineOutcome::LIMIT};
+      const EngineOutcome OUTCOME{RESULT.IsFailed(0) ? FAILED_OUTCOME : (RESULT.IsAccepted(0) ? EngineOutcome::ACCEPTED : EngineOutcome::REJECTED)};
+      return EngineRun{OUTCOME, RESULT.transitions[0], ELAPSED()};
+    }
+    case 4:
+    case 5:
+      // The run of "cached" fills the cache, and the run of "cache-hit" is answered from it.
+      return RunPDA(*cached, INPUT);
+    case 6:
+      if (!isGenerated) {
+        break;
+      }
+      if (generatedRuns.count(INPUT) == 0) {
+        Prepare({INPUT});
+      }
+      return generatedRuns.at(INPUT);
+  }
+  throw std::invalid_argument{"Stress error: Engine " + std::to_string(ENGINE) + " not found"};
+}
+
+/**
+ * @brief Gets the number of engines enabled by some options.
+ * 
+ * @param OPTIONS Options of the harness.
+ * @return The number of engines. Their indexes go from 0 to this number, excluded.
+ */
+size_t StressEngines::Count(const StressOptions& OPTIONS) {
+  return OPTIONS.generated ? NAMES.size() : GENERATED;
+}
+
+/**
+ * @brief Gets the engine another engine is compared with.
+ * 
+ * @param ENGINE Index of the engine.
+ * @return The index of "cached" for "cache-hit", and the index of the reference for the rest.
+ */
+size_t StressEngines::ReferenceOf(const size_t ENGINE) {
+  return ENGINE == 5 ? 4 : REFERENCE;
+}
+
+/**
+ * @brief Checks if two outcomes disagree. Inconclusive outcomes agree with every other outcome.
+ * 
+ * @param ONE Outcome of an engine.
+ * @param OTHER Outcome of another engine.
+ * @return true If both outcomes are conclusive and different.
+ * @return false Otherwise.
+ */
+bool StressEngines::Disagree(const EngineOutcome ONE, const EngineOutcome OTHER) {
+  return ONE != EngineOutcome::LIMIT && OTHER != EngineOutcome::LIMIT && ONE != OTHER;
+}
+
+/**
+ * @brief Converts an outcome to a string.
+ * 
+ * @param OUTCOME Outcome to convert.
+ * @return The outcome as a string.
+ */
+std::string StressEngines::OutcomeToString(const EngineOutcome OUTCOME) {
+  switch (OUTCOME) {
+    case EngineOutcome::ACCEPTED:
+      return "Accepted";
+    case EngineOutcome::REJECTED:
+      return "Rejected";
+    case EngineOutcome::INVALID:
+      return "Invalid symbol";
+    default:
+      return "Maximum number of transitions reached";
+  }
+}
+
+/**
+ * @brief Runs PDA::Accepts on an input string.
+ * 
+ * @param automaton PDA to run.
+ * @param INPUT Input string to check.
+ * @return The outcome of the PDA, the transitions it processed and the time it took.
+ */
+EngineRun StressEngines::RunPDA(PDA& automaton, const std::string& INPUT) const {
+  const auto START{std::chrono::steady_clock::now()};
+  EngineOutcome outcome{EngineOutcome::LIMIT};
+  try {
+    outcome = automaton.Accepts(INPUT) ? EngineOutcome::ACCEPTED : EngineOutcome::REJECTED;
+  } catch (const std::invalid_argument&) {
+    outcome = EngineOutcome::INVALID;
+  } catch (const std::runtime_error&) {}
+  const uint64_t NANOSECONDS{static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - START).count())};
+  return EngineRun{outcome, automaton.TransitionCounter(), NANOSECONDS};
+}
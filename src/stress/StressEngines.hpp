@@ -0,0 +1,81 @@
+/**
+ * @file StressEngines.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to run every acceptance engine on a PDA of the stress harness.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include "StressCase.hpp"
+#include "../generator/GeneratedRecognizer.hpp"
+#include "../registry/PDARegistry.hpp"
+#include "../search/GuidedSearch.hpp"
+
+/**
+ * @brief Outcome of an engine on an input string. 'LIMIT' means the maximum number of transitions was reached, so the
+ *        outcome is inconclusive. 'INVALID' means the input string has symbols the engine does not accept, such as the empty
+ *        symbol.
+ */
+enum class EngineOutcome { REJECTED, ACCEPTED, LIMIT, INVALID };
+
+/**
+ * @brief Result of running an engine on an input string.
+ */
+struct EngineRun {
+  EngineOutcome outcome;
+  uint64_t transitions;
+  uint64_t nanoseconds;
+};
+
+/**
+ * @brief Class to run every acceptance engine on the same PDA. Each engine loads the PDA from the same text:
+ * 
+ *        - "bfs": breadth-first search of PDA::Accepts. It is the reference the other engines are compared with, except
+ *          "cache-hit".
+ * 
+ *        - "optimized": PDA::Accepts after PDA::Optimize.
+ * 
+ *        - "guided": best-first search of GuidedSearch.
+ * 
+ *        - "registry": breadth-first search of PDARegistry, with two threads. The optimized PDA is registered too, so both
+ *          PDAs are evaluated in parallel on the worker pool, and the outcome of the first one is reported.
+ * 
+ *        - "cached": PDA::Accepts with a result cache. Its first run of each input string fills the cache, unless the cache
+ *          is shared between cases and has an entry of a PDA with a colliding fingerprint, which is then detected.
+ * 
+ *        - "cache-hit": the same PDA and cache run again, so the result is answered from the cache. It is compared with the
+ *          "cached" run that filled the cache, which must run first.
+ * 
+ *        - "generated": recognizer of PDACodeGenerator, only if enabled in the options. It is compiled the first time it is
+ *          needed, and Prepare runs it on every input string of a case in a single process, so the time of each input
+ *          string is the mean of the whole run.
+ */
+class StressEngines {
+  public:
+    const static std::vector<std::string> NAMES;
+    const static size_t REFERENCE;
+    const static size_t GENERATED;
+
+    StressEngines(const StressCase&, const StressOptions&, const std::shared_ptr<ResultCache>&);
+    void Prepare(const std::vector<std::string>&);
+    EngineRun Run(size_t, const std::string&);
+    static size_t Count(const StressOptions&);
+    static size_t ReferenceOf(size_t);
+    static bool Disagree(EngineOutcome, EngineOutcome);
+    static std::string OutcomeToString(EngineOutcome);
+  private:
+    std::unique_ptr<PDA> reference;
+    std::unique_ptr<PDA> optimized;
+    std::unique_ptr<PDA> cached;
+    std::unique_ptr<GuidedSearch> guided;
+    PDARegistry registry;
+    bool isGenerated;
+    std::string recognizerName;
+    std::unique_ptr<GeneratedRecognizer> recognizer;
+    std::map<std::string, EngineRun> generatedRuns;
+    static unsigned recognizerCounter;
+    EngineRun RunPDA(PDA&, const std::string&) const;
+};
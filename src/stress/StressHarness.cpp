@@ -0,0 +1,255 @@
+/**
+ * @file StressHarness.cpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the definition of the class to compare every acceptance engine on random PDAs and input strings.
+ * @date 19/10/2026
+ */
+
+#include "StressHarness.hpp"
+
+/**
+ * @brief Constructs a new StressHarness object.
+ * 
+ * @param OPTIONS Parameters of the random PDAs and input strings.
+ */
+StressHarness::StressHarness(const StressOptions& OPTIONS) : options(OPTIONS), random(OPTIONS.seed), statistics(StressEngines::NAMES.size(), EngineStatistics{0, 0, 0, 0, 0, 0, 0}) {
+  // Shared by every case, so entries of different PDAs with the same fingerprint would be mixed up.
+  cache = std::make_shared<ResultCache>(size_t{1} << 20);
+}
+
+/**
+ * @brief Generates the random PDAs and input strings, running every engine on them. Each disagreement with the reference is
+ *        reported, and the first one of each engine in a case is minimized and written as a reproducer.
+ * 
+ * @param output Stream to report the disagreements to.
+ * @return The number of disagreements found.
+ * @throw std::runtime_error If a reproducer cannot be written, or the generated recognizer cannot be compiled or run.
+ */
+uint64_t StressHarness::Run(std::ostream& output) {
+  uint64_t disagreements{0};
+  for (unsigned caseNumber{0}; caseNumber < options.cases; ++caseNumber) {
+    const StressCase STRESS_CASE{StressCase::Generate(options, random)};
+    StressEngines engines{STRESS_CASE, options, cache};
+    std::vector<bool> isReproduced(StressEngines::NAMES.size(), false);
+    std::vector<std::string> inputs;
+    for (unsigned i{0}; i < options.inputs; ++i) {
+      inputs.emplace_back(i % 2 == 0 ? STRESS_CASE.WalkInput(options, random) : STRESS_CASE.RandomInput(options, random));
+    }
+    engines.Prepare(inputs);
+    for (const std::string& INPUT : inputs) {
+      std::vector<EngineRun> runs;
+      for (size_t engine{0}; engine < StressEngines::Count(options); ++engine) {
+        runs.emplace_back(engines.Run(engine, INPUT));
+        EngineStatistics& engineStatistics{statistics[engine]};
+        ++engineStatistics.runs;
+        engineStatistics.accepted += runs.back().outcome == EngineOutcome::ACCEPTED;
+        engineStatistics.limits += runs.back().outcome == EngineOutcome::LIMIT;
+        engineStatistics.invalid += runs.back().outcome == EngineOutcome::INVALID;
+        engineStatistics.transitions += runs.back().transitions;
+        engineStatistics.nanoseconds += runs.back().nanoseconds;
+      }
+      for (size_t engine{0}; engine < StressEngines::Count(options); ++engine) {
+        const size_t REFERENCE{StressEngines::ReferenceOf(engine)};
+        if (!StressEngines::Disagree(runs[REFERENCE].outcome, runs[engine].outcome)) {
+          continue;
+        }
+        ++disagreements;
+        ++statistics[engine].disagreements;
+        output << "Case " << caseNumber << ": '" << StressEngines::NAMES[engine] << "' disagrees on input string '" << INPUT << "' ("
+               << StressEngines::NAMES[REFERENCE] << ": " << StressEngines::OutcomeToString(runs[REFERENCE].outcome) << ", "
+               << StressEngines::NAMES[engine] << ": " << StressEngines::OutcomeToString(runs[engine].outcome) << ")\n";
+        if (!isReproduced[engine]) {
+          isReproduced[engine] = true;
+          output << "--> Reproducer written to " << WriteReproducer(caseNumber, STRESS_CASE, INPUT, engine) << "\n";
+        }
+      }
+    }
+  }
+  return disagreements;
+}
+
+/**
+ * @brief Writes a table with the statistics of every engine.
+ * 
+ * @param output Stream to write the table to.
+ */
+void StressHarness::WriteReport(std::ostream& output) const {
+  output << std::left << std::setw(12) << "Engine" << std::right << std::setw(10) << "Runs" << std::setw(10) << "Accepted" << std::setw(10) << "Limits"
+         << std::setw(10) << "Invalid" << std::setw(15) << "Disagreements" << std::setw(14) << "Transitions" << std::setw(12) << "Time (ms)" << std::setw(12) << "Mean (us)" << "\n";
+  for (size_t engine{0}; engine < StressEngines::Count(options); ++engine) {
+    const EngineStatistics& ENGINE_STATISTICS{statistics[engine]};
+    output << std::left << std::setw(12) << StressEngines::NAMES[engine] << std::right << std::setw(10) << ENGINE_STATISTICS.runs
+           << std::setw(10) << ENGINE_STATISTICS.accepted << std::setw(10) << ENGINE_STATISTICS.limits << std::setw(10) << ENGINE_STATISTICS.invalid << std::setw(15) << ENGINE_STATISTICS.disagreements
+           << std::setw(14) << ENGINE_STATISTICS.transitions << std::setw(12) << std::fixed << std::setprecision(1) << ENGINE_STATISTICS.nanoseconds / 1e6
+           << std::setw(12) << std::setprecision(2) << (ENGINE_STATISTICS.runs == 0 ? 0.0 : ENGINE_STATISTICS.nanoseconds / 1e3 / ENGINE_STATISTICS.runs) << "\n";
+  }
+}
+
+/**
+ * @brief Appends the statistics of every engine to the CSV file of the options, writing its header if the file is new, so
+ *        the results of different runs can be compared.
+ * 
+ * @throw std::runtime_error If the file cannot be written.
+ */
+void StressHarness::AppendCsv() const {
+  const bool IS_NEW{!std::ifstream{options.csvFileName}.good()};
+  std::ofstream writer{options.csvFileName, std::ios::app};
+  if (!writer.is_open()) {
+    throw std::runtime_error{"Stress error: File '" + options.csvFileName + "' cannot be written"};
+  }
+  if (IS_NEW) {
+    writer << "seed,cases,engine,runs,accepted,limits,invalid,disagreements,transitions,nanoseconds\n";
+  }
+  for (size_t engine{0}; engine < StressEngines::Count(options); ++engine) {
+    const EngineStatistics& ENGINE_STATISTICS{statistics[engine]};
+    writer << options.seed << "," << options.cases << "," << StressEngines::NAMES[engine] << "," << ENGINE_STATISTICS.runs << "," << ENGINE_STATISTICS.accepted << ","
+           << ENGINE_STATISTICS.limits << "," << ENGINE_STATISTICS.invalid << "," << ENGINE_STATISTICS.disagreements << "," << ENGINE_STATISTICS.transitions << "," << ENGINE_STATISTICS.nanoseconds << "\n";
+  }
+}
+
+/**
+ * @brief Minimizes a disagreement and writes it as a reproducer in the output directory.
+ * 
+ * @param CASE_NUMBER Number of the case in the run.
+ * @param STRESS_CASE PDA where the disagreement was found.
+ * @param INPUT Input string where the disagreement was found.
+ * @param ENGINE Index of the engine which disagrees with the reference.
+ * @return The name of the reproducer file.
+ * @throw std::runtime_error If the file cannot be written.
+ */
+std::string StressHarness::WriteReproducer(const unsigned CASE_NUMBER, const StressCase& STRESS_CASE, const std::string& INPUT, const size_t ENGINE) const {
+  const auto [MINIMIZED_CASE, MINIMIZED_INPUT]{Minimize(STRESS_CASE, INPUT, ENGINE)};
+  StressEngines engines{MINIMIZED_CASE, options, std::make_shared<ResultCache>(size_t{1} << 20)};
+  const std::string FILENAME{options.outputDirectory + "/APv-stress-" + std::to_string(options.seed) + "-" + std::to_string(CASE_NUMBER) + "-" + StressEngines::NAMES[ENGINE] + ".txt"};
+  std::ofstream writer{FILENAME};
+  if (!writer.is_open()) {
+    throw std::runtime_error{"Stress error: File '" + FILENAME + "' cannot be written"};
+  }
+  writer << "# Reproducer of the stress harness (seed " << options.seed << ", case " << CASE_NUMBER << ")\n";
+  writer << "# Input string: '" << MINIMIZED_INPUT << "'\n";
+  for (const size_t RUN_ENGINE : {StressEngines::ReferenceOf(ENGINE), ENGINE}) {
+    writer << "# " << StressEngines::NAMES[RUN_ENGINE] << ": " << StressEngines::OutcomeToString(engines.Run(RUN_ENGINE, MINIMIZED_INPUT).outcome) << "\n";
+  }
+  writer << MINIMIZED_CASE.ToString();
+  return FILENAME;
+}
+
+/**
+ * @brief Shrinks a disagreement while it persists: first the input string, symbol by symbol, then the transitions of the
+ *        PDA and the symbols they push, until nothing can be removed. Finally, the unused states and symbols are dropped.
+ * 
+ * @param STRESS_CASE PDA where the disagreement was found.
+ * @param INPUT Input string where the disagreement was found.
+ * @param ENGINE Index of the engine which disagrees with the reference.
+ * @return The minimized PDA and input string. They are the given ones if the disagreement does not persist on its own,
+ *         for example if it depends on the cache shared between cases.
+ */
+std::pair<StressCase, std::string> StressHarness::Minimize(const StressCase& STRESS_CASE, const std::string& INPUT, const size_t ENGINE) const {
+  if (!Reproduces(STRESS_CASE, INPUT, ENGINE)) {
+    return {STRESS_CASE, INPUT};
+  }
+  StressCase minimizedCase{STRESS_CASE};
+  std::string minimizedInput{INPUT};
+  bool changed{true};
+  while (changed) {
+    changed = false;
+    for (size_t i{0}; i < minimizedInput.size();) {
+      const std::string CANDIDATE{minimizedInput.substr(0, i) + minimizedInput.substr(i + 1)};
+      if (Reproduces(minimizedCase, CANDIDATE, ENGINE)) {
+        minimizedInput = CANDIDATE;
+        changed = true;
+      } else {
+        ++i;
+      }
+    }
+    for (size_t i{0}; i < minimizedCase.Transitions().size();) {
+      std::vector<StressTransition> transitions{minimizedCase.Transitions()};
+      transitions.erase(transitions.begin() + i);
+      const StressCase CANDIDATE{minimizedCase.States(), minimizedCase.InputAlphabet(), minimizedCase.StackAlphabet(), transitions};
+      if (Reproduces(CANDIDATE, minimizedInput, ENGINE)) {
+        minimizedCase = CANDIDATE;
+        changed = true;
+      } else {
+        ++i;
+      }
+    }
+    for (size_t i{0}; i < minimizedCase.Transitions().size(); ++i) {
+      for (size_t j{0}; j < minimizedCase.Transitions()[i].pushed.size();) {
+        std::vector<StressTransition> transitions{minimizedCase.Transitions()};
+        transitions[i].pushed.erase(j, 1);
+        const StressCase CANDIDATE{minimizedCase.States(), minimizedCase.InputAlphabet(), minimizedCase.StackAlphabet(), transitions};
+        if (Reproduces(CANDIDATE, minimizedInput, ENGINE)) {
+          minimizedCase = CANDIDATE;
+          changed = true;
+        } else {
+          ++j;
+        }
+      }
+    }
+  }
+  const StressCase COMPACT_CASE{RemoveUnused(minimizedCase, minimizedInput)};
+  if (Reproduces(COMPACT_CASE, minimizedInput, ENGINE)) {
+    minimizedCase = COMPACT_CASE;
+  }
+  return {minimizedCase, minimizedInput};
+}
+
+/**
+ * @brief Checks if an engine disagrees with the engine it is compared with on a PDA and an input string. The cached engines
+ *        get an empty cache of their own.
+ * 
+ * @param STRESS_CASE PDA to check.
+ * @param INPUT Input string to check.
+ * @param ENGINE Index of the engine to compare.
+ * @return true If both engines are conclusive and disagree.
+ * @return false Otherwise.
+ */
+bool StressHarness::Reproduces(const StressCase& STRESS_CASE, const std::string& INPUT, const size_t ENGINE) const {
+  StressEngines engines{STRESS_CASE, options, std::make_shared<ResultCache>(size_t{1} << 20)};
+  // The engine compared with runs first, so "cached" fills the cache before "cache-hit".
+  const EngineOutcome EXPECTED{engines.Run(StressEngines::ReferenceOf(ENGINE), INPUT).outcome};
+  return StressEngines::Disagree(EXPECTED, engines.Run(ENGINE, INPUT).outcome);
+}
+
+/**
+ * @brief Drops the states which no transition uses, except the initial one, and the symbols which neither the transitions
+ *        nor the input string use, except the initial stack symbol. The remaining states are numbered again in order.
+ * 
+ * @param STRESS_CASE PDA to compact.
+ * @param INPUT Input string whose symbols are kept.
+ * @return The compacted PDA.
+ */
+StressCase StressHarness::RemoveUnused(const StressCase& STRESS_CASE, const std::string& INPUT) {
+  std::vector<bool> isStateUsed(STRESS_CASE.States(), false);
+  isStateUsed[0] = true;
+  std::set<char> usedSymbols{INPUT.begin(), INPUT.end()};
+  usedSymbols.insert(STRESS_CASE.StackAlphabet()[0]);
+  for (const StressTransition& TRANSITION : STRESS_CASE.Transitions()) {
+    isStateUsed[TRANSITION.fromState] = true;
+    isStateUsed[TRANSITION.toState] = true;
+    usedSymbols.insert({TRANSITION.inputSymbol, TRANSITION.stackTop});
+    usedSymbols.insert(TRANSITION.pushed.begin(), TRANSITION.pushed.end());
+  }
+  const auto IS_USED{[&usedSymbols](const char SYMBOL) { return usedSymbols.count(SYMBOL) > 0; }};
+  std::string inputAlphabet;
+  std::copy_if(STRESS_CASE.InputAlphabet().begin(), STRESS_CASE.InputAlphabet().end(), std::back_inserter(inputAlphabet), IS_USED);
+  // The input alphabet line of the file cannot be empty.
+  if (inputAlphabet.empty()) {
+    inputAlphabet = STRESS_CASE.InputAlphabet().substr(0, 1);
+  }
+  std::string stackAlphabet;
+  std::copy_if(STRESS_CASE.StackAlphabet().begin(), STRESS_CASE.StackAlphabet().end(), std::back_inserter(stackAlphabet), IS_USED);
+  std::vector<unsigned> stateIndexes(STRESS_CASE.States(), 0);
+  unsigned states{0};
+  for (unsigned state{0}; state < STRESS_CASE.States(); ++state) {
+    if (isStateUsed[state]) {
+      stateIndexes[state] = states++;
+    }
+  }
+  std::vector<StressTransition> transitions{STRESS_CASE.Transitions()};
+  for (StressTransition& transition : transitions) {
+    transition.fromState = stateIndexes[transition.fromState];
+    transition.toState = stateIndexes[transition.toState];
+  }
+  return StressCase{states, inputAlphabet, stackAlphabet, transitions};
+}
@@ -0,0 +1,57 @@
+/**
+ * @file StressHarness.hpp
+ * @author Juan Rodríguez Suárez
+ * @brief Contains the class to compare every acceptance engine on random PDAs and input strings.
+ * @date 19/10/2026
+ */
+
+#pragma once
+
+#include <iomanip>
+
+#include "StressEngines.hpp"
+
+/**
+ * @brief Statistics of an engine over every input string of a run.
+ */
+struct EngineStatistics {
+  uint64_t runs;
+  uint64_t accepted;
+  uint64_t limits;
+  uint64_t invalid;
+  uint64_t disagreements;
+  uint64_t transitions;
+  uint64_t nanoseconds;
+};
+
+/**
+ * @brief Class to compare every acceptance engine with the reference breadth-first search on random PDAs and input strings.
+ *        Half of the input strings follow random transitions of the PDA until its stack is empty, so they are usually
+ *        accepted, and the other half are random. When an engine disagrees with the reference:
+ * 
+ *        - The input string is shrunk, and then the transitions of the PDA and their pushed symbols are removed, while the
+ *          disagreement persists. Finally, the unused states and symbols are dropped.
+ * 
+ *        - The minimized PDA is written as a reproducer in the format of the APv-*.txt files, with the input string and the
+ *          outcomes of both engines as comments.
+ * 
+ *        Outcomes where an engine reached the maximum number of transitions are inconclusive and never disagree. The
+ *        transitions processed and the time taken by each engine are recorded, so performance regressions show up next to
+ *        the correctness ones.
+ */
+class StressHarness {
+  public:
+    StressHarness(const StressOptions&);
+    uint64_t Run(std::ostream&);
+    void WriteReport(std::ostream&) const;
+    void AppendCsv() const;
+  private:
+    StressOptions options;
+    std::mt19937 random;
+    std::shared_ptr<ResultCache> cache;
+    std::vector<EngineStatistics> statistics;
+    std::string WriteReproducer(unsigned, const StressCase&, const std::string&, size_t) const;
+    std::pair<StressCase, std::string> Minimize(const StressCase&, const std::string&, size_t) const;
+    bool Reproduces(const StressCase&, const std::string&, size_t) const;
+    static StressCase RemoveUnused(const StressCase&, const std::string&);
+};
@@ -8,7 +8,7 @@
 #include "PDA.hpp"
 
 /**
- * @brief Maximum number of transitions to process.
+ * @brief Default maximum number of transitions to process.
  */
 const unsigned PDA::MAX_TRANSITIONS{10000000};
 
@@ -21,23 +21,72 @@ const unsigned PDA::MAX_TRANSITIONS{10000000};
  * @param INITIAL_STACK Initial stack of the PDA.
  */
 PDA::PDA(const std::map<std::string, State*>& STATES, const Alphabet& INNER_ALPHABET, State* givenInitialState, const PDAStack& INITIAL_STACK)
-         : states(STATES), innerAlphabet(INNER_ALPHABET), initialState(givenInitialState), initialStack(INITIAL_STACK) {
+         : states(STATES), innerAlphabet(INNER_ALPHABET), inputClasses(INNER_ALPHABET), initialState(givenInitialState), initialStack(INITIAL_STACK) {
   isTraceEnabled = false;
+  isOptimized = false;
+  maxTransitions = MAX_TRANSITIONS;
+  fingerprint = ComputeFingerprint();
 }
 
 /**
- * @brief Checks if the PDA accepts a given input string.
+ * @brief Checks if the PDA accepts a given input string. If a cache is set, the result is looked up first and stored after
+ *        the search; cache hits process no transitions.
  * 
  * @param INPUT Input string to check.
  * @return true If the PDA accepts the input string.
  * @return false If the PDA does not accept the input string.
  * @throw std::runtime_error If the maximum number of transitions is reached.
+ * @throw std::invalid_argument If a symbol of the input string is not in the PDA alphabet or is the empty symbol.
  */
 bool PDA::Accepts(const std::string& INPUT) {
+  bool accepted;
+  if (cache != nullptr && cache->Find(fingerprint, INPUT, accepted)) {
+    transitionCounter = 0;
+    return accepted;
+  }
+  // If the search throws, nothing is stored in the cache.
+  accepted = Search(INPUT);
+  if (cache != nullptr) {
+    cache->Insert(fingerprint, INPUT, accepted);
+  }
+  return accepted;
+}
+
+/**
+ * @brief Sets the cache of results used by Accepts. It can be shared with other PDAs, as entries are keyed by fingerprint.
+ * 
+ * @param givenCache Cache of results, or nullptr to disable caching.
+ */
+void PDA::SetCache(const std::shared_ptr<ResultCache>& givenCache) {
+  cache = givenCache;
+}
+
+/**
+ * @brief Returns the fingerprint of the PDA, computed from its definition when it is constructed.
+ * 
+ * @return The fingerprint of the PDA.
+ */
+size_t PDA::Fingerprint() const {
+  return fingerprint;
+}
+
+/**
+ * @brief Searches breadth-first for a sequence of transitions which consumes the input string and empties the stack.
+ * 
+ * @param INPUT Input string to check.
+ * @return true If the PDA accepts the input string.
+ * @return false If the PDA does not accept the input string.
+ * @throw std::runtime_error If the maximum number of transitions is reached.
+ * @throw std::invalid_argument If a symbol of the input string is not in the PDA alphabet or is the empty symbol.
+ */
+bool PDA::Search(const std::string& INPUT) {
   pendantTransitions = std::queue<TransitionInfo>{};
   transitionCounter = 0;
+  // Translating the input string once into the classes of its symbols, which also validates it.
+  inputSymbols = inputClasses.Translate(INPUT);
+  currentInput = INPUT;
   // Pushing the initial state to the queue of transitions.
-  pendantTransitions.push(TransitionInfo{initialState, Symbol::ToSymbols(INPUT), initialStack});
+  pendantTransitions.push(TransitionInfo{initialState, 0, initialStack});
   // Processing transitions until the stack is empty or the input string is consumed and the stack is empty.
   while (!pendantTransitions.empty()) {
     ++transitionCounter;
@@ -46,7 +95,7 @@ bool PDA::Accepts(const std::string& INPUT) {
       return true;
     }
     // If the maximum number of transitions is reached, we stop the process and throw an exception.
-    if (transitionCounter == MAX_TRANSITIONS) {
+    if (transitionCounter == maxTransitions) {
       throw std::runtime_error{"Runtime error: Maximum number of transitions reached."};
     }
   }
@@ -58,45 +107,39 @@ bool PDA::Accepts(const std::string& INPUT) {
  * 
  * @return true If the stack is empty and the input string is consumed.
  * @return false If the stack is empty and the input string is not consumed or the stack is not empty.
- * @throw std::invalid_argument If a symbol of the input string is not in the PDA alphabet.
  */
 bool PDA::ProcessTransition() {
-  // Retrieving the current transition, which contains the actual state, the input symbols to consume and the stack.
+  // Retrieving the current transition, which contains the actual state, the position of the next input symbol and the stack.
   const TransitionInfo& CURRENT_TRANSITION{pendantTransitions.front()};
   if (isTraceEnabled) {
     PrintTransitionTrace(CURRENT_TRANSITION);
   }
   State* actualState{std::get<0>(CURRENT_TRANSITION)};
-  const std::vector<Symbol>& INPUT_SYMBOLS{std::get<1>(CURRENT_TRANSITION)};
+  const size_t INPUT_POSITION{std::get<1>(CURRENT_TRANSITION)};
+  const bool IS_INPUT_CONSUMED{INPUT_POSITION == inputSymbols.size()};
   PDAStack stack{std::get<2>(CURRENT_TRANSITION)};
   // If the stack is empty, we check if the input string is consumed.
   if (stack.IsEmpty()) {
     pendantTransitions.pop();
-    return INPUT_SYMBOLS.empty();
+    return IS_INPUT_CONSUMED;
   }
   // Getting the top of the stack and the actual symbol to consume to find the next possible transitions.
   const Symbol STACK_TOP{stack.Pop()};
-  const Symbol& ACTUAL_SYMBOL{INPUT_SYMBOLS.empty() ? Symbol::EPSILON : INPUT_SYMBOLS[0]};
-  // If the actual symbol is not in the PDA alphabet, we throw an exception.
-  if (innerAlphabet.find(ACTUAL_SYMBOL) == innerAlphabet.end()) {
-    const std::string ALPHABET_STR{std::accumulate(innerAlphabet.begin(), innerAlphabet.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })};
-    throw std::invalid_argument{"Runtime error: Symbol: '" + ACTUAL_SYMBOL.ToString() + "' not found in PDA alphabet ( " + ALPHABET_STR + ")"};
-  }
+  const Symbol& ACTUAL_SYMBOL{IS_INPUT_CONSUMED ? Symbol::EPSILON : inputSymbols[INPUT_POSITION]};
   // Retrieving the possible transitions from the actual state with the actual symbol and the top of the stack.
   const auto& POSSIBLE_TRANSITIONS{actualState->Transitions().GetTransitions(ACTUAL_SYMBOL, STACK_TOP)};
   // For each possible transition, we create a new transition with the next state, the new input symbols and the new stack.
   for (const auto& TRANSITION : POSSIBLE_TRANSITIONS) {
     State* nextState{std::get<0>(TRANSITION)};
     const std::vector<Symbol>& NEW_STACK_SYMBOLS{std::get<1>(TRANSITION)};
-    const std::vector<Symbol>& NEW_INPUT_SYMBOLS{INPUT_SYMBOLS.size() > 1 ? std::vector<Symbol>{INPUT_SYMBOLS.begin() + 1, INPUT_SYMBOLS.end()} : std::vector<Symbol>{}};
     PDAStack newStack{stack};
     // Pushing the new symbols to the stack.
     newStack.Push(NEW_STACK_SYMBOLS);
     // Adding the new transition to the queue of transitions.
-    pendantTransitions.push(TransitionInfo{nextState, NEW_INPUT_SYMBOLS, newStack});
-    // Printing the next transitions if the trace mode is enabled.
+    pendantTransitions.push(TransitionInfo{nextState, IS_INPUT_CONSUMED ? INPUT_POSITION : INPUT_POSITION + 1, newStack});
+    // Printing the next transitions if the trace mode is enabled, with the original symbol instead of its class.
     if (isTraceEnabled) {
-      PrintNextTransitions(actualState, ACTUAL_SYMBOL, STACK_TOP, nextState, NEW_STACK_SYMBOLS);
+      PrintNextTransitions(actualState, IS_INPUT_CONSUMED ? Symbol::EPSILON : Symbol{currentInput[INPUT_POSITION]}, STACK_TOP, nextState, NEW_STACK_SYMBOLS);
     }
   }
   // Checking epsilon transitions only if we have not checked them yet.
@@ -107,7 +150,7 @@ bool PDA::ProcessTransition() {
       const std::vector<Symbol>& NEW_STACK_SYMBOLS{std::get<1>(TRANSITION)};
       PDAStack newStack{stack};
       newStack.Push(NEW_STACK_SYMBOLS);
-      pendantTransitions.push(TransitionInfo{nextState, INPUT_SYMBOLS, newStack});
+      pendantTransitions.push(TransitionInfo{nextState, INPUT_POSITION, newStack});
       if (isTraceEnabled) {
         PrintNextTransitions(actualState, Symbol::EPSILON, STACK_TOP, nextState, NEW_STACK_SYMBOLS);
       }
@@ -118,6 +161,35 @@ bool PDA::ProcessTransition() {
   return false;
 }
 
+/**
+ * @brief Computes a fingerprint of the definition of the PDA: its alphabets, initial configuration and transitions.
+ * 
+ * @return The fingerprint of the PDA.
+ */
+size_t PDA::ComputeFingerprint() const {
+  std::string definition{initialState->ToString() + "\n" + initialStack.ToString() + "\n"};
+  for (const Symbol& SYMBOL : innerAlphabet) {
+    definition += SYMBOL.ToString();
+  }
+  definition += "\n";
+  for (const Symbol& SYMBOL : initialStack.StackAlphabet()) {
+    definition += SYMBOL.ToString();
+  }
+  for (const auto& STATE : states) {
+    for (const auto& INPUT_TRANSITIONS : STATE.second->Transitions().Entries()) {
+      for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+        for (const TransitionResult& RESULT : STACK_TRANSITIONS.second) {
+          definition += "\n" + STATE.first + " " + INPUT_TRANSITIONS.first.ToString() + " " + STACK_TRANSITIONS.first.ToString() + " " + std::get<0>(RESULT)->ToString() + " ";
+          for (const Symbol& SYMBOL : std::get<1>(RESULT)) {
+            definition += SYMBOL.ToString();
+          }
+        }
+      }
+    }
+  }
+  return std::hash<std::string>{}(definition);
+}
+
 /**
  * @brief Prints the current transition trace.
  * 
@@ -127,9 +199,7 @@ void PDA::PrintTransitionTrace(const TransitionInfo& TRANSITION) const {
   std::cout << "--------------------\nCurrent transition:";
   std::cout << "\n\tState: " + std::get<0>(TRANSITION)->ToString();
   std::cout << "\n\tSymbols: ";
-  for (const Symbol& SYMBOL : std::get<1>(TRANSITION)) {
-    std::cout << SYMBOL.ToString();
-  }
+  std::cout << currentInput.substr(std::get<1>(TRANSITION));
   std::cout << "\n\tStack: ";
   std::cout << std::get<2>(TRANSITION).ToString();
   std::cout << "\n\tNext transitions:\n";
@@ -156,6 +226,25 @@ void PDA::PrintNextTransitions(State* origin, const Symbol& TO_CONSUME, const Sy
   std::cout << "\n\n";
 }
 
+/**
+ * @brief Runs the optimization passes over the states of the PDA and groups its input symbols into equivalence classes.
+ *        Later calls to Accepts run on the simplified automaton. Calling it again leaves the PDA unchanged.
+ * 
+ * @return A report of the size of the PDA before and after the optimization.
+ */
+std::string PDA::Optimize() {
+  // The transitions of the symbols which are not representatives are already gone, so the classes cannot be rebuilt.
+  if (isOptimized) {
+    return "PDA already optimized";
+  }
+  isOptimized = true;
+  PDAOptimizer optimizer{states, initialState};
+  optimizer.Run();
+  inputClasses = InputClasses{states, innerAlphabet};
+  inputClasses.Compress(states);
+  return optimizer.Report() + "\n\tInput symbol classes: " + std::to_string(innerAlphabet.size()) + " -> " + std::to_string(inputClasses.Size());
+}
+
 /**
  * @brief Enables the trace mode of the PDA.
  */
@@ -172,6 +261,69 @@ unsigned PDA::TransitionCounter() const {
   return transitionCounter;
 }
 
+/**
+ * @brief Sets the maximum number of transitions processed by each call to Accepts.
+ * 
+ * @param MAX Maximum number of transitions to process.
+ */
+void PDA::SetMaxTransitions(const unsigned MAX) {
+  maxTransitions = MAX;
+}
+
+/**
+ * @brief Returns the maximum number of transitions processed by each call to Accepts.
+ * 
+ * @return The maximum number of transitions to process.
+ */
+unsigned PDA::MaxTransitions() const {
+  return maxTransitions;
+}
+
+/**
+ * @brief Returns a read-only reference to the states of the PDA.
+ * 
+ * @return A read-only reference to the states of the PDA.
+ */
+const std::map<std::string, State*>& PDA::States() const {
+  return states;
+}
+
+/**
+ * @brief Returns a read-only reference to the input alphabet of the PDA, including the empty symbol.
+ * 
+ * @return A read-only reference to the input alphabet of the PDA.
+ */
+const Alphabet& PDA::InputAlphabet() const {
+  return innerAlphabet;
+}
+
+/**
+ * @brief Returns a read-only reference to the equivalence classes of the input symbols.
+ * 
+ * @return A read-only reference to the equivalence classes of the input symbols.
+ */
+const InputClasses& PDA::Classes() const {
+  return inputClasses;
+}
+
+/**
+ * @brief Returns the initial state of the PDA.
+ * 
+ * @return The initial state of the PDA.
+ */
+State* PDA::InitialState() const {
+  return initialState;
+}
+
+/**
+ * @brief Returns a read-only reference to the initial stack of the PDA.
+ * 
+ * @return A read-only reference to the initial stack of the PDA.
+ */
+const PDAStack& PDA::InitialStack() const {
+  return initialStack;
+}
+
 /**
  * @brief Destroys the PDA object, freeing the memory of the states.
  */
@@ -12,12 +12,15 @@
 
 #include "state.hpp"
 #include "PDAStack.hpp"
+#include "../optimization/PDAOptimizer.hpp"
+#include "../optimization/InputClasses.hpp"
+#include "../cache/ResultCache.hpp"
 
 /**
- * @brief Type to represent the state of a PDA after a transition. The tuple contains actual state, input symbols to consume 
- *        and stack symbols to push.
+ * @brief Type to represent the state of a PDA after a transition. The tuple contains actual state, position of the next input 
+ *        symbol to consume and stack.
  */
-using TransitionInfo = std::tuple<State*, std::vector<Symbol>, PDAStack>;
+using TransitionInfo = std::tuple<State*, size_t, PDAStack>;
 
 /**
  * @brief Class to represent a stack emptying Pushdown Automaton. A PDA is a tuple (Q, Σ, Γ, δ, q0, Z0) where:
@@ -35,19 +38,40 @@ class PDA {
     const static unsigned MAX_TRANSITIONS;
 
     PDA(const std::map<std::string, State*>&, const Alphabet&, State*, const PDAStack&);
+    PDA(const PDA&) = delete;
+    PDA& operator=(const PDA&) = delete;
     bool Accepts(const std::string&);
+    void SetCache(const std::shared_ptr<ResultCache>&);
+    size_t Fingerprint() const;
+    std::string Optimize();
     void EnableTrace();
     unsigned TransitionCounter() const;
+    void SetMaxTransitions(unsigned);
+    unsigned MaxTransitions() const;
+    const std::map<std::string, State*>& States() const;
+    const Alphabet& InputAlphabet() const;
+    const InputClasses& Classes() const;
+    State* InitialState() const;
+    const PDAStack& InitialStack() const;
     ~PDA();
   private:
     std::queue<TransitionInfo> pendantTransitions;
     std::map<std::string, State*> states;
     Alphabet innerAlphabet;
+    InputClasses inputClasses;
+    std::vector<Symbol> inputSymbols;
+    std::string currentInput;
     State* initialState;
     PDAStack initialStack;
     bool isTraceEnabled;
+    bool isOptimized;
     unsigned transitionCounter;
+    unsigned maxTransitions;
+    std::shared_ptr<ResultCache> cache;
+    size_t fingerprint;
+    bool Search(const std::string&);
     bool ProcessTransition();
+    size_t ComputeFingerprint() const;
     void PrintTransitionTrace(const TransitionInfo&) const;
     void PrintNextTransitions(State*, const Symbol&, const Symbol&, State*, const std::vector<Symbol>&) const;
 };
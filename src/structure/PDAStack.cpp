@@ -7,13 +7,37 @@
 
 #include "PDAStack.hpp"
 
+/**
+ * @brief Code value of the characters that are not in the stack alphabet.
+ */
+const int16_t StackEncoding::NO_CODE{-1};
+
+/**
+ * @brief Constructs a new StackEncoding object, assigning a code to each symbol in alphabet order.
+ * 
+ * @param ALPHABET Alphabet of the stack symbols.
+ */
+StackEncoding::StackEncoding(const Alphabet& ALPHABET) : alphabet(ALPHABET), symbols(ALPHABET.begin(), ALPHABET.end()) {
+  codes.fill(NO_CODE);
+  for (size_t i{0}; i < symbols.size(); ++i) {
+    codes[static_cast<unsigned char>(symbols[i].Value())] = static_cast<int16_t>(i);
+  }
+  bitsPerSymbol = 1;
+  while ((size_t{1} << bitsPerSymbol) < symbols.size()) {
+    ++bitsPerSymbol;
+  }
+  symbolsPerWord = 64 / bitsPerSymbol;
+  symbolMask = (uint64_t{1} << bitsPerSymbol) - 1;
+}
+
 /**
  * @brief Constructs a new PDAStack object.
  * 
  * @param INNER_ALPHABET Alphabet of the stack symbols.
  * @param INITIAL_SYMBOL Initial symbol of the stack.
  */
-PDAStack::PDAStack(const Alphabet& INNER_ALPHABET, const Symbol& INITIAL_SYMBOL) : innerAlphabet(INNER_ALPHABET) {
+PDAStack::PDAStack(const Alphabet& INNER_ALPHABET, const Symbol& INITIAL_SYMBOL) : encoding(std::make_shared<const StackEncoding>(INNER_ALPHABET)), size(0) {
+  inlineWords.fill(0);
   Push(INITIAL_SYMBOL);
 }
 
@@ -27,23 +51,32 @@ void PDAStack::Push(const Symbol& SYMBOL) {
   if (SYMBOL == Symbol::EPSILON) {
     return;
   }
-  if (innerAlphabet.find(SYMBOL) == innerAlphabet.end()) {
-    const std::string ALPHABET_STR{std::accumulate(innerAlphabet.begin(), innerAlphabet.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })};
+  const int16_t CODE{encoding->codes[static_cast<unsigned char>(SYMBOL.Value())]};
+  if (CODE == StackEncoding::NO_CODE) {
+    const std::string ALPHABET_STR{std::accumulate(encoding->alphabet.begin(), encoding->alphabet.end(), std::string{}, [](const std::string& ACCOUNT, const Symbol& SYMBOL) { return ACCOUNT + SYMBOL.ToString() + " "; })};
     throw std::invalid_argument{"Reading file error: Stack symbol: '" + SYMBOL.ToString() + "' not found in stack alphabet ( " + ALPHABET_STR + ")"};
   }
-  stack.push(SYMBOL);
+  const size_t WORD_INDEX{size / encoding->symbolsPerWord};
+  // Moving to the heap buffer only when the inline buffer is full.
+  if (heapWords.empty() && WORD_INDEX >= INLINE_WORDS) {
+    heapWords.assign(inlineWords.begin(), inlineWords.end());
+  }
+  if (!heapWords.empty() && WORD_INDEX >= heapWords.size()) {
+    heapWords.push_back(0);
+  }
+  const unsigned SHIFT{static_cast<unsigned>(size % encoding->symbolsPerWord) * encoding->bitsPerSymbol};
+  Words()[WORD_INDEX] |= static_cast<uint64_t>(CODE) << SHIFT;
+  ++size;
 }
 
 /**
- * @brief Pushes a vector of symbols to the stack.
+ * @brief Pushes a vector of symbols to the stack. The first symbol of the vector ends on top.
  * 
  * @param SYMBOLS Symbols to push.
  */
 void PDAStack::Push(const std::vector<Symbol>& SYMBOLS) {
-  std::vector<Symbol> reversedSymbols{SYMBOLS};
-  std::reverse(reversedSymbols.begin(), reversedSymbols.end());
-  for (const Symbol& SYMBOL : reversedSymbols) {
-    Push(SYMBOL);
+  for (auto it{SYMBOLS.rbegin()}; it != SYMBOLS.rend(); ++it) {
+    Push(*it);
   }
 }
 
@@ -53,11 +86,23 @@ void PDAStack::Push(const std::vector<Symbol>& SYMBOLS) {
  * @return The symbol popped.
  */
 Symbol PDAStack::Pop() {
-  const Symbol SYMBOL{stack.top()};
-  stack.pop();
+  const Symbol SYMBOL{Top()};
+  --size;
+  // Clearing the bits of the popped symbol, so equal stacks always have equal words.
+  const unsigned SHIFT{static_cast<unsigned>(size % encoding->symbolsPerWord) * encoding->bitsPerSymbol};
+  Words()[size / encoding->symbolsPerWord] &= ~(encoding->symbolMask << SHIFT);
   return SYMBOL;
 }
 
+/**
+ * @brief Returns the symbol on top of the stack without removing it.
+ * 
+ * @return The symbol on top of the stack.
+ */
+Symbol PDAStack::Top() const {
+  return encoding->symbols[CodeAt(size - 1)];
+}
+
 /**
  * @brief Checks if the stack is empty.
  * 
@@ -65,7 +110,61 @@ Symbol PDAStack::Pop() {
  * @return false If the stack is not empty.
  */
 bool PDAStack::IsEmpty() const {
-  return stack.empty();
+  return size == 0;
+}
+
+/**
+ * @brief Returns the number of symbols in the stack.
+ * 
+ * @return The number of symbols in the stack.
+ */
+size_t PDAStack::Size() const {
+  return size;
+}
+
+/**
+ * @brief Computes a hash of the stack contents, one word at a time.
+ * 
+ * @return The hash of the stack.
+ */
+size_t PDAStack::Hash() const {
+  uint64_t hash{size * 0x9E3779B97F4A7C15ULL};
+  const uint64_t* WORDS{Words()};
+  for (size_t i{0}; i < UsedWords(); ++i) {
+    hash ^= WORDS[i] + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+  }
+  return static_cast<size_t>(hash);
+}
+
+/**
+ * @brief Returns a read-only reference to the stack alphabet.
+ * 
+ * @return A read-only reference to the stack alphabet.
+ */
+const Alphabet& PDAStack::StackAlphabet() const {
+  return encoding->alphabet;
+}
+
+/**
+ * @brief Compares two stacks, one word at a time.
+ * 
+ * @param OTHER Stack to compare.
+ * @return true If both stacks contain the same symbols.
+ * @return false If the stacks are different.
+ */
+bool PDAStack::operator==(const PDAStack& OTHER) const {
+  return size == OTHER.size && std::equal(Words(), Words() + UsedWords(), OTHER.Words());
+}
+
+/**
+ * @brief Compares two stacks.
+ * 
+ * @param OTHER Stack to compare.
+ * @return true If the stacks are different.
+ * @return false If both stacks contain the same symbols.
+ */
+bool PDAStack::operator!=(const PDAStack& OTHER) const {
+  return !(*this == OTHER);
 }
 
 /**
@@ -75,10 +174,46 @@ bool PDAStack::IsEmpty() const {
  */
 std::string PDAStack::ToString() const {
   std::string result;
-  std::stack<Symbol> tempStack{stack};
-  while (!tempStack.empty()) {
-    result += tempStack.top().ToString();
-    tempStack.pop();
+  for (size_t i{size}; i > 0; --i) {
+    result += encoding->symbols[CodeAt(i - 1)].ToString();
   }
   return result;
 }
+
+/**
+ * @brief Returns the number of words holding symbols.
+ * 
+ * @return The number of words holding symbols.
+ */
+size_t PDAStack::UsedWords() const {
+  return (size + encoding->symbolsPerWord - 1) / encoding->symbolsPerWord;
+}
+
+/**
+ * @brief Returns a read-only pointer to the buffer in use.
+ * 
+ * @return The inline buffer, or the heap buffer if the stack has grown beyond it.
+ */
+const uint64_t* PDAStack::Words() const {
+  return heapWords.empty() ? inlineWords.data() : heapWords.data();
+}
+
+/**
+ * @brief Returns a pointer to the buffer in use.
+ * 
+ * @return The inline buffer, or the heap buffer if the stack has grown beyond it.
+ */
+uint64_t* PDAStack::Words() {
+  return heapWords.empty() ? inlineWords.data() : heapWords.data();
+}
+
+/**
+ * @brief Returns the code of the symbol at a given position, counting from the bottom.
+ * 
+ * @param INDEX Position of the symbol.
+ * @return The code of the symbol.
+ */
+unsigned PDAStack::CodeAt(const size_t INDEX) const {
+  const unsigned SHIFT{static_cast<unsigned>(INDEX % encoding->symbolsPerWord) * encoding->bitsPerSymbol};
+  return static_cast<unsigned>((Words()[INDEX / encoding->symbolsPerWord] >> SHIFT) & encoding->symbolMask);
+}
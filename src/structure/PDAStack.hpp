@@ -7,7 +7,10 @@
 
 #pragma once
 
-#include <stack>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <stdexcept>
 #include <set>
 #include <numeric>
@@ -20,18 +23,60 @@
  */
 using Alphabet = std::set<Symbol>;
 
+/**
+ * @brief Encoding of a stack alphabet shared by every copy of a stack. Each symbol is mapped to a code of
+ *        ceil(log2 |Γ|) bits, and the codes are packed in 64 bit words without straddling word boundaries.
+ */
+struct StackEncoding {
+  static const int16_t NO_CODE;
+
+  StackEncoding(const Alphabet&);
+
+  Alphabet alphabet;
+  std::vector<Symbol> symbols;
+  std::array<int16_t, 256> codes;
+  unsigned bitsPerSymbol;
+  unsigned symbolsPerWord;
+  uint64_t symbolMask;
+};
+
 /**
  * @brief Class to represent the stack of a PDA. The stack is a LIFO structure which contains symbols from a stack alphabet.
+ *        Symbols are stored bit-packed; shallow stacks live in an inline buffer and only deep stacks allocate memory.
  */
 class PDAStack {
   public:
+    const static unsigned INLINE_WORDS = 2;
+
     PDAStack(const Alphabet&, const Symbol&);
     void Push(const Symbol&);
     void Push(const std::vector<Symbol>&);
     Symbol Pop();
+    Symbol Top() const;
     bool IsEmpty() const;
+    size_t Size() const;
+    size_t Hash() const;
+    const Alphabet& StackAlphabet() const;
+    bool operator==(const PDAStack&) const;
+    bool operator!=(const PDAStack&) const;
     std::string ToString() const;
   private:
-    const Alphabet innerAlphabet;
-    std::stack<Symbol> stack;
+    std::shared_ptr<const StackEncoding> encoding;
+    std::array<uint64_t, INLINE_WORDS> inlineWords;
+    std::vector<uint64_t> heapWords;
+    size_t size;
+    size_t UsedWords() const;
+    const uint64_t* Words() const;
+    uint64_t* Words();
+    unsigned CodeAt(size_t) const;
 };
+
+/**
+ * @brief Hash specialization so stacks can be used as keys of unordered containers.
+ */
+namespace std {
+  template <>
+  struct hash<PDAStack> {
+    size_t operator()(const PDAStack& STACK) const { return STACK.Hash(); }
+  };
+}
@@ -88,6 +88,15 @@ const std::string Symbol::ToString() const {
   return std::string{value};
 }
 
+/**
+ * @brief Returns the character value of the symbol.
+ * 
+ * @return The character value of the symbol.
+ */
+char Symbol::Value() const {
+  return value;
+}
+
 /**
  * @brief Swaps a symbol with another.
  * 
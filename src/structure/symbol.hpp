@@ -24,6 +24,7 @@ class Symbol {
     bool operator<(const Symbol&) const;
     Symbol& operator=(const Symbol&);
     const std::string ToString() const;
+    char Value() const;
   private: 
     char value;
 };
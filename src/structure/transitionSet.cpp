@@ -59,4 +59,37 @@ const std::vector<TransitionResult>& TransitionSet::GetTransitions(const Symbol&
     return EMPTY_TRANSITION_RESULTS;
   }
   return transitions.at(INPUT_SYMBOL).at(STACK_SYMBOL);
+}
+
+/**
+ * @brief Returns a read-only reference to all the transitions, indexed by input symbol and stack top.
+ * 
+ * @return A read-only reference to all the transitions.
+ */
+const TransitionMap& TransitionSet::Entries() const {
+  return transitions;
+}
+
+/**
+ * @brief Returns a reference to all the transitions, indexed by input symbol and stack top.
+ * 
+ * @return A reference to all the transitions.
+ */
+TransitionMap& TransitionSet::Entries() {
+  return transitions;
+}
+
+/**
+ * @brief Returns the number of transitions in the set.
+ * 
+ * @return The number of transitions in the set.
+ */
+size_t TransitionSet::Size() const {
+  size_t size{0};
+  for (const auto& INPUT_TRANSITIONS : transitions) {
+    for (const auto& STACK_TRANSITIONS : INPUT_TRANSITIONS.second) {
+      size += STACK_TRANSITIONS.second.size();
+    }
+  }
+  return size;
 }
\ No newline at end of file
@@ -19,6 +19,11 @@ class State;
  */
 using TransitionResult = std::tuple<State*, std::vector<Symbol>>;
 
+/**
+ * @brief Type to represent the transitions of a state, indexed by input symbol and then by stack top.
+ */
+using TransitionMap = std::map<Symbol, std::map<Symbol, std::vector<TransitionResult>>>;
+
 class TransitionSet {
   public:
     static const std::vector<TransitionResult> EMPTY_TRANSITION_RESULTS;
@@ -26,6 +31,9 @@ class TransitionSet {
     void AddTransition(const Symbol&, const Symbol&, State*, const std::vector<Symbol>&);
     bool HasTransitions(const Symbol&, const Symbol&) const;
     const std::vector<TransitionResult>& GetTransitions(const Symbol&, const Symbol&) const;
+    const TransitionMap& Entries() const;
+    TransitionMap& Entries();
+    size_t Size() const;
   private:
-    std::map<Symbol, std::map<Symbol, std::vector<TransitionResult>>> transitions;
+    TransitionMap transitions;
 };